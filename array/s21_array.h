@@ -1,52 +1,130 @@
-#include "s21_vector.h"
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector_iterator.h"
 
 namespace s21 {
 
+// Fixed-size array stored inline, an aggregate like std::array: it is built
+// with brace initialization, copies as plain bytes when T is trivially
+// copyable and can be used in constant expressions. Iteration goes through
+// the same iterators as Vector.
 template <typename T, size_t N>
-class Array {
- public:
-  using sequence = s21::Vector<T>;
+struct Array {
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
-  using iterator = typename sequence::iterator;
-  using const_iterator = typename sequence::const_iterator;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = VectorIterator<T>;
+  using const_iterator = ConstVectorIterator<T>;
   using size_type = size_t;
 
-  Array() : s(N) {}
-  explicit Array(size_type size, const_reference value = {}) : s(size, value) {}
-  Array(std::initializer_list<value_type> const& items) : s(items) {}
-  Array(const Array& other) = default;
-  Array(Array&& other) = default;
-  ~Array() = default;
-
-  Array& operator=(const Array& other) = default;
-  Array& operator=(Array&& other) = default;
-
-  reference at(size_type pos) { return s.at(pos); }
-  const_reference at(size_type pos) const { return s.at(pos); }
-  reference operator[](size_type pos) { return s[pos]; }
-  const_reference front() { return s.front(); }
-  const_reference back() { return s.back(); }
-
-  iterator begin() { return s.begin(); }
-  iterator end() { return s.end(); }
-  const_iterator begin() const { return s.begin(); }
-  const_iterator end() const { return s.end(); }
-  const_iterator cbegin() const { return s.cbegin(); }
-  const_iterator cend() const { return s.cend(); }
-
-  bool empty() const noexcept { return s.empty(); }
-  size_type size() const noexcept { return s.size(); }
-  void swap(Array& other) { s.swap(other.s); }
-  void fill(const_reference value) {
-    for (size_t i = 0; i < size(); ++i) {
-      s[i] = value;
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos) { return at(pos); }
+  constexpr const_reference operator[](size_type pos) const { return at(pos); }
+  constexpr reference front() { return at(0); }
+  constexpr const_reference front() const { return at(0); }
+  constexpr reference back() { return at(N - 1); }
+  constexpr const_reference back() const { return at(N - 1); }
+  constexpr pointer data() noexcept { return elems_; }
+  constexpr const_pointer data() const noexcept { return elems_; }
+
+  iterator begin() { return iterator(elems_, N); }
+  iterator end() { return begin() + N; }
+  const_iterator begin() const { return const_iterator(elems_, N); }
+  const_iterator end() const { return begin() + N; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  constexpr bool empty() const noexcept { return N == 0; }
+  constexpr size_type size() const noexcept { return N; }
+  constexpr size_type max_size() const noexcept { return N; }
+
+  constexpr void fill(const_reference value);
+  void swap(Array& other) noexcept(std::is_nothrow_swappable_v<T>);
+
+  // Public so that the type stays an aggregate; a zero-sized array still
+  // needs one slot, which is never exposed.
+  T elems_[N == 0 ? 1 : N];
+};
+
+template <typename T, size_t N>
+constexpr typename Array<T, N>::reference Array<T, N>::at(size_type pos) {
+  if (pos >= N) {
+    throw std::out_of_range("Error: Attempt to access beyond the array");
+  }
+  return elems_[pos];
+}
+
+template <typename T, size_t N>
+constexpr typename Array<T, N>::const_reference Array<T, N>::at(
+    size_type pos) const {
+  if (pos >= N) {
+    throw std::out_of_range("Error: Attempt to access beyond the array");
+  }
+  return elems_[pos];
+}
+
+template <typename T, size_t N>
+constexpr void Array<T, N>::fill(const_reference value) {
+  for (size_type i = 0; i < N; ++i) {
+    elems_[i] = value;
+  }
+}
+
+template <typename T, size_t N>
+void Array<T, N>::swap(Array& other) noexcept(std::is_nothrow_swappable_v<T>) {
+  std::swap_ranges(elems_, elems_ + N, other.elems_);
+}
+
+template <typename T, size_t N>
+constexpr bool operator==(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+  for (size_t i = 0; i < N; ++i) {
+    if (!(lhs.elems_[i] == rhs.elems_[i])) {
+      return false;
     }
   }
+  return true;
+}
 
- private:
-  sequence s;
-};
+template <typename T, size_t N>
+constexpr bool operator!=(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, size_t N>
+constexpr bool operator<(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+  for (size_t i = 0; i < N; ++i) {
+    if (lhs.elems_[i] < rhs.elems_[i]) {
+      return true;
+    }
+    if (rhs.elems_[i] < lhs.elems_[i]) {
+      return false;
+    }
+  }
+  return false;
+}
+
+template <typename T, size_t N>
+constexpr bool operator>(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, size_t N>
+constexpr bool operator<=(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, size_t N>
+constexpr bool operator>=(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+  return !(lhs < rhs);
+}
 
 }  // namespace s21
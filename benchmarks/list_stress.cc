@@ -0,0 +1,87 @@
+// Builds and tears down one very long List, and a queue of the same depth.
+// Teardown has to run in constant stack space, so a recursive node
+// destructor would crash here long before the timings are printed.
+//
+// Usage: list_stress [nodes]   (default: 100000001)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../s21_containers.h"
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double seconds_since(clock_type::time_point start) {
+  return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+void stress_list(size_t nodes) {
+  auto start = clock_type::now();
+  s21::List<int> list;
+  for (size_t i = 0; i < nodes; ++i) {
+    list.push_back(static_cast<int>(i));
+  }
+  std::printf("list push_back  %zu nodes: %.2fs\n", list.size(),
+              seconds_since(start));
+
+  start = clock_type::now();
+  long long sum = 0;
+  for (int value : list) {
+    sum += value;
+  }
+  std::printf("list traversal  checksum %lld: %.2fs\n", sum,
+              seconds_since(start));
+
+  start = clock_type::now();
+  list = s21::List<int>{1, 2, 3};
+  std::printf("list operator= over the long list: %.2fs\n",
+              seconds_since(start));
+
+  for (size_t i = 0; i < nodes; ++i) {
+    list.push_back(static_cast<int>(i));
+  }
+  start = clock_type::now();
+  list.clear();
+  std::printf("list clear: %.2fs\n", seconds_since(start));
+
+  for (size_t i = 0; i < nodes; ++i) {
+    list.push_back(static_cast<int>(i));
+  }
+  start = clock_type::now();
+  {
+    s21::List<int> doomed(std::move(list));
+  }
+  std::printf("list destructor: %.2fs\n", seconds_since(start));
+}
+
+void stress_queue(size_t nodes) {
+  auto start = clock_type::now();
+  {
+    s21::queue<int> queue;
+    for (size_t i = 0; i < nodes; ++i) {
+      queue.push(static_cast<int>(i));
+    }
+    for (size_t i = 0; i < nodes / 2; ++i) {
+      queue.pop();
+    }
+  }
+  std::printf("queue fill, half drain, destroy: %.2fs\n",
+              seconds_since(start));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t nodes = 100000001;
+  if (argc > 1) {
+    nodes = std::strtoull(argv[1], nullptr, 10);
+  }
+
+  stress_list(nodes);
+  stress_queue(nodes);
+
+  return 0;
+}
@@ -0,0 +1,479 @@
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_deque_iterator.h"
+
+namespace s21 {
+
+// Double-ended queue stored in fixed-size blocks reached through a map of
+// block pointers. Pushing or popping at either end is O(1) and allocates at
+// most one block; elements never move once built, so references stay valid
+// across insertions and removals at the ends. Iterators are invalidated
+// whenever the map grows.
+//
+// Slot a (counted from the start of the map) lives in block a / kBlockSize;
+// [start_, start_ + size_) are the live slots. Blocks are allocated as the
+// ends reach them and released once they empty out; only the blocks holding
+// live slots, or the block holding start_, are ever allocated.
+template <typename T, typename Allocator = std::allocator<T>>
+class Deque {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using block_pointer = typename alloc_traits::pointer;
+  using map_allocator =
+      typename alloc_traits::template rebind_alloc<block_pointer>;
+  using map_traits = std::allocator_traits<map_allocator>;
+
+  static_assert(std::is_same_v<block_pointer, T*>,
+                "Deque requires an allocator with raw pointers");
+
+  static constexpr size_t kBlockSize = deque_block_size<T>();
+  static constexpr size_t kMinMapSize = 8;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = DequeIterator<T>;
+  using const_iterator = DequeIterator<const T>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  Deque() : Deque(Allocator()) {}
+  explicit Deque(const Allocator& alloc) noexcept : alloc_(alloc) {}
+  explicit Deque(size_type count, const_reference value = value_type{},
+                 const Allocator& alloc = Allocator());
+  Deque(std::initializer_list<value_type> const& items,
+        const Allocator& alloc = Allocator());
+  Deque(const Deque& other);
+  Deque(const Deque& other, const Allocator& alloc);
+  Deque(Deque&& other) noexcept;
+  Deque(Deque&& other, const Allocator& alloc);
+  ~Deque();
+
+  Deque& operator=(const Deque& other);
+  Deque& operator=(Deque&& other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value);
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) { return at(pos); }
+  const_reference operator[](size_type pos) const { return at(pos); }
+  reference front() { return at(0); }
+  const_reference front() const { return at(0); }
+  reference back() { return at(size_ - 1); }
+  const_reference back() const { return at(size_ - 1); }
+
+  iterator begin() noexcept { return iterator(map_, start_); }
+  iterator end() noexcept { return iterator(map_, start_ + size_); }
+  const_iterator begin() const noexcept {
+    return const_iterator(map_, start_);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(map_, start_ + size_);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+
+  void clear() noexcept;
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(T&& value) { emplace_front(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+  template <typename... Args>
+  void insert_many_front(Args&&... args);
+  void pop_back();
+  void pop_front();
+  void swap(Deque& other) noexcept;
+
+ private:
+  pointer slot(size_type index) const noexcept {
+    return map_[index / kBlockSize] + index % kBlockSize;
+  }
+  bool ensure_block(size_type block);
+  void free_block(size_type block) noexcept;
+  void grow_map();
+  void release() noexcept;
+  void steal(Deque& other) noexcept;
+  void move_elements(Deque& other);
+
+  block_pointer* map_{nullptr};
+  size_type map_size_{0};
+  size_type start_{0};
+  size_type size_{0};
+  Allocator alloc_;
+};
+
+template <typename T, typename A>
+Deque<T, A>::Deque(size_type count, const_reference value, const A& alloc)
+    : alloc_(alloc) {
+  try {
+    while (count--) {
+      push_back(value);
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(std::initializer_list<value_type> const& items,
+                   const A& alloc)
+    : alloc_(alloc) {
+  try {
+    for (auto& el : items) {
+      push_back(el);
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(const Deque& other)
+    : Deque(other,
+            alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(const Deque& other, const A& alloc) : alloc_(alloc) {
+  try {
+    for (auto& el : other) {
+      push_back(el);
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(Deque&& other) noexcept : alloc_(std::move(other.alloc_)) {
+  steal(other);
+}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(Deque&& other, const A& alloc) : alloc_(alloc) {
+  if (alloc_ == other.alloc_) {
+    steal(other);
+    return;
+  }
+  try {
+    move_elements(other);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+Deque<T, A>::~Deque() {
+  release();
+}
+
+template <typename T, typename A>
+Deque<T, A>& Deque<T, A>::operator=(const Deque& other) {
+  if (this == &other) {
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+    if (alloc_ != other.alloc_) {
+      release();
+    }
+    alloc_ = other.alloc_;
+  }
+  clear();
+  for (auto& el : other) {
+    push_back(el);
+  }
+
+  return *this;
+}
+
+template <typename T, typename A>
+Deque<T, A>& Deque<T, A>::operator=(Deque&& other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
+  if (this == &other) {
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    release();
+    alloc_ = std::move(other.alloc_);
+    steal(other);
+  } else if (alloc_ == other.alloc_) {
+    release();
+    steal(other);
+  } else {
+    move_elements(other);
+  }
+
+  return *this;
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::reference Deque<T, A>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the deque");
+  }
+  return *slot(start_ + pos);
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::const_reference Deque<T, A>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the deque");
+  }
+  return *slot(start_ + pos);
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::size_type Deque<T, A>::max_size() const noexcept {
+  return std::min<size_type>(alloc_traits::max_size(alloc_),
+                             std::numeric_limits<difference_type>::max());
+}
+
+template <typename T, typename A>
+void Deque<T, A>::clear() noexcept {
+  while (size_) {
+    pop_back();
+  }
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename Deque<T, A>::reference Deque<T, A>::emplace_back(Args&&... args) {
+  if (size_ == max_size()) {
+    throw std::length_error("Error: Requested size exceeds max_size");
+  }
+  if (start_ + size_ == map_size_ * kBlockSize) {
+    grow_map();
+  }
+  size_type index = start_ + size_;
+  bool fresh = ensure_block(index / kBlockSize);
+  try {
+    alloc_traits::construct(alloc_, slot(index), std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) {
+      free_block(index / kBlockSize);
+    }
+    throw;
+  }
+  ++size_;
+  return *slot(index);
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename Deque<T, A>::reference Deque<T, A>::emplace_front(Args&&... args) {
+  if (size_ == max_size()) {
+    throw std::length_error("Error: Requested size exceeds max_size");
+  }
+  if (start_ == 0) {
+    grow_map();
+  }
+  size_type index = start_ - 1;
+  bool fresh = ensure_block(index / kBlockSize);
+  try {
+    alloc_traits::construct(alloc_, slot(index), std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) {
+      free_block(index / kBlockSize);
+    }
+    throw;
+  }
+  --start_;
+  ++size_;
+  return *slot(index);
+}
+
+template <typename T, typename A>
+template <typename... Args>
+void Deque<T, A>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+// Each argument is pushed to the front in turn, so the last one ends up
+// first.
+template <typename T, typename A>
+template <typename... Args>
+void Deque<T, A>::insert_many_front(Args&&... args) {
+  (emplace_front(std::forward<Args>(args)), ...);
+}
+
+// A deque that becomes empty keeps its last block and restarts from the
+// middle of it, so that it can grow again in both directions without
+// touching the allocator.
+template <typename T, typename A>
+void Deque<T, A>::pop_back() {
+  if (!size_) {
+    return;
+  }
+  size_type index = start_ + --size_;
+  alloc_traits::destroy(alloc_, slot(index));
+  if (!size_) {
+    start_ = index / kBlockSize * kBlockSize + kBlockSize / 2;
+  } else if (index % kBlockSize == 0) {
+    free_block(index / kBlockSize);
+  }
+}
+
+template <typename T, typename A>
+void Deque<T, A>::pop_front() {
+  if (!size_) {
+    return;
+  }
+  size_type index = start_++;
+  alloc_traits::destroy(alloc_, slot(index));
+  if (!--size_) {
+    start_ = index / kBlockSize * kBlockSize + kBlockSize / 2;
+  } else if (start_ % kBlockSize == 0) {
+    free_block(index / kBlockSize);
+  }
+}
+
+template <typename T, typename A>
+void Deque<T, A>::swap(Deque& other) noexcept {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+}
+
+// Returns whether the block had to be allocated.
+template <typename T, typename A>
+bool Deque<T, A>::ensure_block(size_type block) {
+  if (map_[block]) {
+    return false;
+  }
+  try {
+    map_[block] = alloc_traits::allocate(alloc_, kBlockSize);
+  } catch (std::bad_alloc& e) {
+    throw std::runtime_error("Error: Failed to allocate memory");
+  }
+  return true;
+}
+
+template <typename T, typename A>
+void Deque<T, A>::free_block(size_type block) noexcept {
+  alloc_traits::deallocate(alloc_, map_[block], kBlockSize);
+  map_[block] = nullptr;
+}
+
+// Makes room for one more block at either end. The blocks in use are
+// re-centred in the map, which is reallocated at twice the size only when
+// they take up more than half of it, so alternating growth at the two ends
+// cannot make the map grow without bound.
+template <typename T, typename A>
+void Deque<T, A>::grow_map() {
+  size_type first = start_ / kBlockSize;
+  size_type used =
+      size_ ? (start_ + size_ - 1) / kBlockSize - first + 1 : 1;
+  size_type new_size = map_size_;
+  block_pointer* new_map = map_;
+  if (map_size_ < 2 * (used + 1)) {
+    new_size = std::max({map_size_ * 2, 2 * (used + 1), kMinMapSize});
+    map_allocator map_alloc(alloc_);
+    try {
+      new_map = map_traits::allocate(map_alloc, new_size);
+    } catch (std::bad_alloc& e) {
+      throw std::runtime_error("Error: Failed to allocate memory");
+    }
+    std::fill(new_map, new_map + new_size, nullptr);
+  }
+
+  size_type new_first = (new_size - used) / 2;
+  if (map_) {
+    if (new_map != map_) {
+      std::copy(map_ + first, map_ + first + used, new_map + new_first);
+      map_allocator map_alloc(alloc_);
+      map_traits::deallocate(map_alloc, map_, map_size_);
+    } else if (new_first < first) {
+      std::copy(map_ + first, map_ + first + used, map_ + new_first);
+      std::fill(map_ + std::max(first, new_first + used), map_ + first + used,
+                nullptr);
+    } else if (new_first > first) {
+      std::copy_backward(map_ + first, map_ + first + used,
+                         map_ + new_first + used);
+      std::fill(map_ + first, map_ + std::min(new_first, first + used),
+                nullptr);
+    }
+  }
+  map_ = new_map;
+  map_size_ = new_size;
+  start_ = new_first * kBlockSize + start_ % kBlockSize;
+}
+
+template <typename T, typename A>
+void Deque<T, A>::release() noexcept {
+  clear();
+  for (size_type i = 0; i < map_size_; ++i) {
+    if (map_[i]) {
+      free_block(i);
+    }
+  }
+  if (map_) {
+    map_allocator map_alloc(alloc_);
+    map_traits::deallocate(map_alloc, map_, map_size_);
+  }
+  map_ = nullptr;
+  map_size_ = start_ = 0;
+}
+
+template <typename T, typename A>
+void Deque<T, A>::steal(Deque& other) noexcept {
+  map_ = other.map_;
+  map_size_ = other.map_size_;
+  start_ = other.start_;
+  size_ = other.size_;
+  other.map_ = nullptr;
+  other.map_size_ = other.start_ = other.size_ = 0;
+}
+
+// Fallback of the moves when other's blocks belong to an unequal allocator.
+template <typename T, typename A>
+void Deque<T, A>::move_elements(Deque& other) {
+  clear();
+  for (auto& el : other) {
+    emplace_back(std::move(el));
+  }
+  other.clear();
+}
+
+namespace pmr {
+
+template <typename T>
+using Deque = s21::Deque<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
+}  // namespace s21
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace s21 {
+
+// Elements per Deque block: about 4 KiB worth, rounded down to a power of
+// two so that locating an element is a shift and a mask, and never fewer
+// than 16.
+template <typename T>
+constexpr size_t deque_block_size() noexcept {
+  size_t size = 16;
+  while (size * 2 * sizeof(T) <= 4096) {
+    size *= 2;
+  }
+  return size;
+}
+
+// Random-access iterator over the blocks of a Deque. It keeps the block map
+// and an absolute slot index, so stepping across a block boundary costs no
+// more than stepping within one. T is const-qualified for const iterators.
+template <typename T>
+class DequeIterator {
+  using block_pointer = std::remove_const_t<T>*;
+  static constexpr size_t kBlockSize =
+      deque_block_size<std::remove_const_t<T>>();
+
+ public:
+  using value_type = std::remove_const_t<T>;
+  using pointer = T*;
+  using reference = T&;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+
+  DequeIterator() = default;
+  DequeIterator(const block_pointer* map, size_t index) noexcept
+      : map_(map), index_(index) {}
+  template <typename U, typename = std::enable_if_t<
+                            std::is_same_v<const U, T> &&
+                            !std::is_same_v<U, T>>>
+  DequeIterator(const DequeIterator<U>& other) noexcept
+      : map_(other.map_), index_(other.index_) {}
+
+  reference operator*() const noexcept {
+    return map_[index_ / kBlockSize][index_ % kBlockSize];
+  }
+  pointer operator->() const noexcept { return &**this; }
+  reference operator[](difference_type n) const noexcept {
+    return *(*this + n);
+  }
+
+  DequeIterator& operator++() noexcept;
+  DequeIterator operator++(int) noexcept;
+  DequeIterator& operator--() noexcept;
+  DequeIterator operator--(int) noexcept;
+  DequeIterator& operator+=(difference_type n) noexcept;
+  DequeIterator& operator-=(difference_type n) noexcept;
+  DequeIterator operator+(difference_type n) const noexcept;
+  DequeIterator operator-(difference_type n) const noexcept;
+  difference_type operator-(const DequeIterator& other) const noexcept;
+
+  bool operator==(const DequeIterator& other) const noexcept {
+    return index_ == other.index_;
+  }
+  bool operator!=(const DequeIterator& other) const noexcept {
+    return index_ != other.index_;
+  }
+  bool operator<(const DequeIterator& other) const noexcept {
+    return index_ < other.index_;
+  }
+  bool operator>(const DequeIterator& other) const noexcept {
+    return index_ > other.index_;
+  }
+  bool operator<=(const DequeIterator& other) const noexcept {
+    return index_ <= other.index_;
+  }
+  bool operator>=(const DequeIterator& other) const noexcept {
+    return index_ >= other.index_;
+  }
+
+ private:
+  template <typename>
+  friend class DequeIterator;
+
+  const block_pointer* map_{nullptr};
+  size_t index_{0};
+};
+
+template <typename T>
+DequeIterator<T>& DequeIterator<T>::operator++() noexcept {
+  ++index_;
+  return *this;
+}
+
+template <typename T>
+DequeIterator<T> DequeIterator<T>::operator++(int) noexcept {
+  auto tmp{*this};
+  ++index_;
+  return tmp;
+}
+
+template <typename T>
+DequeIterator<T>& DequeIterator<T>::operator--() noexcept {
+  --index_;
+  return *this;
+}
+
+template <typename T>
+DequeIterator<T> DequeIterator<T>::operator--(int) noexcept {
+  auto tmp{*this};
+  --index_;
+  return tmp;
+}
+
+template <typename T>
+DequeIterator<T>& DequeIterator<T>::operator+=(difference_type n) noexcept {
+  index_ += n;
+  return *this;
+}
+
+template <typename T>
+DequeIterator<T>& DequeIterator<T>::operator-=(difference_type n) noexcept {
+  index_ -= n;
+  return *this;
+}
+
+template <typename T>
+DequeIterator<T> DequeIterator<T>::operator+(
+    difference_type n) const noexcept {
+  auto tmp{*this};
+  return tmp += n;
+}
+
+template <typename T>
+DequeIterator<T> DequeIterator<T>::operator-(
+    difference_type n) const noexcept {
+  auto tmp{*this};
+  return tmp -= n;
+}
+
+template <typename T>
+typename DequeIterator<T>::difference_type DequeIterator<T>::operator-(
+    const DequeIterator& other) const noexcept {
+  return static_cast<difference_type>(index_ - other.index_);
+}
+
+template <typename T>
+DequeIterator<T> operator+(typename DequeIterator<T>::difference_type n,
+                           const DequeIterator<T>& it) noexcept {
+  return it + n;
+}
+
+}  // namespace s21
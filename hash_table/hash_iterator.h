@@ -5,21 +5,29 @@
 
 namespace s21 {
 
-template <typename, typename, typename>
+template <typename, typename, typename, typename>
 class hash_table;
 
-template <typename K, typename V>
+// Walks the buckets of a hash_table and the List inside each. The position
+// is held as raw bucket pointers plus a List iterator, three words in all,
+// so stepping within a bucket is a single pointer load.
+template <typename K, typename V, typename Allocator>
 class base_hash_iterator {
  public:
-  friend class hash_table<K, V, std::hash<K>>;
+  template <typename, typename, typename, typename>
+  friend class hash_table;
   using key_type = K;
   using mapped_type = std::remove_const_t<V>;
   using value_type = std::pair<key_type, mapped_type>;
   using reference = value_type&;
   using pointer = value_type*;
   using iterator_category = std::forward_iterator_tag;
-  using bucket = List<value_type>;
-  using table_it = typename Vector<bucket>::iterator;
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using bucket_allocator =
+      typename alloc_traits::template rebind_alloc<value_type>;
+  using bucket = List<value_type, bucket_allocator>;
+  using table_allocator = typename alloc_traits::template rebind_alloc<bucket>;
+  using table_it = typename Vector<bucket, table_allocator>::iterator;
   using bucket_it = typename bucket::iterator;
 
   base_hash_iterator(const base_hash_iterator& other) = default;
@@ -35,15 +43,14 @@ class base_hash_iterator {
 
  protected:
   base_hash_iterator(table_it begin, table_it end, bucket_it b)
-      : begin_(begin), end_(end), b_(b) {}
+      : begin_(begin.operator->()), end_(end.operator->()), b_(b) {}
 
   void advance() {
     if (begin_ == end_) {
       throw std::out_of_range("Error: attempt to access beyond map");
     }
 
-    if (b_ != begin_->end()) {
-      ++b_;
+    if (++b_ != begin_->end()) {
       return;
     }
     ++begin_;
@@ -62,16 +69,17 @@ class base_hash_iterator {
     return b_ == other.b_;
   }
 
-  table_it begin_;
-  table_it end_;
+  bucket* begin_;
+  bucket* end_;
   bucket_it b_;
 };
 
-template <typename K, typename V>
-class hash_iterator : public base_hash_iterator<K, V> {
+template <typename K, typename V, typename Allocator>
+class hash_iterator : public base_hash_iterator<K, V, Allocator> {
  public:
-  friend class hash_table<K, V, std::hash<K>>;
-  using base = base_hash_iterator<K, V>;
+  template <typename, typename, typename, typename>
+  friend class hash_table;
+  using base = base_hash_iterator<K, V, Allocator>;
   using key_type = typename base::key_type;
   using mapped_type = typename base::mapped_type;
   using value_type = typename base::value_type;
@@ -108,11 +116,12 @@ class hash_iterator : public base_hash_iterator<K, V> {
   using base::base;
 };
 
-template <typename K, typename V>
-class const_hash_iterator : public base_hash_iterator<K, const V> {
+template <typename K, typename V, typename Allocator>
+class const_hash_iterator : public base_hash_iterator<K, const V, Allocator> {
  public:
-  friend class hash_table<K, V, std::hash<K>>;
-  using base = base_hash_iterator<K, const V>;
+  template <typename, typename, typename, typename>
+  friend class hash_table;
+  using base = base_hash_iterator<K, const V, Allocator>;
   using key_type = typename base::key_type;
   using mapped_type = typename base::mapped_type;
   using value_type = typename base::value_type;
@@ -6,26 +6,47 @@
 
 namespace s21 {
 
-template <typename K, typename V, typename H = std::hash<K>>
+template <typename K, typename V, typename H = std::hash<K>,
+          typename Allocator = std::allocator<std::pair<K, V>>>
 class hash_table {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
  public:
   using key_type = K;
   using mapped_type = V;
   using value_type = std::pair<key_type, mapped_type>;
-  using bucket = List<value_type>;
+  using allocator_type =
+      typename alloc_traits::template rebind_alloc<value_type>;
+  using bucket = List<value_type, allocator_type>;
+  using table_allocator = typename alloc_traits::template rebind_alloc<bucket>;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = hash_iterator<key_type, mapped_type>;
-  using const_iterator = const_hash_iterator<key_type, mapped_type>;
+  using iterator = hash_iterator<key_type, mapped_type, allocator_type>;
+  using const_iterator =
+      const_hash_iterator<key_type, mapped_type, allocator_type>;
   using size_type = size_t;
 
-  hash_table() : table_(defualt_capacity) {}
+  hash_table() : hash_table(allocator_type()) {}
+  explicit hash_table(const allocator_type& alloc)
+      : table_(defualt_capacity, bucket(alloc), table_allocator(alloc)) {}
   hash_table(const hash_table& other) = default;
+  hash_table(const hash_table& other, const allocator_type& alloc)
+      : size_(other.size_),
+        load_factor(other.load_factor),
+        table_(other.table_, table_allocator(alloc)) {}
   hash_table(hash_table&& other) = default;
+  hash_table(hash_table&& other, const allocator_type& alloc)
+      : size_(other.size_),
+        load_factor(other.load_factor),
+        table_(std::move(other.table_), table_allocator(alloc)) {}
   ~hash_table() = default;
 
-  hash_table<K, V>& operator=(const hash_table& other) = default;
-  hash_table<K, V>& operator=(hash_table&& other) = default;
+  hash_table& operator=(const hash_table& other) = default;
+  hash_table& operator=(hash_table&& other) = default;
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(table_.get_allocator());
+  }
 
   size_type size() const noexcept;
   size_type capacity() const noexcept;
@@ -76,33 +97,33 @@ class hash_table {
   constexpr static int defualt_capacity = 10;
   size_type size_{};
   double load_factor{};
-  Vector<bucket> table_;
+  Vector<bucket, table_allocator> table_;
 };
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::size_type hash_table<K, V, H>::size()
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::size_type hash_table<K, V, H, A>::size()
     const noexcept {
   return size_;
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::size_type hash_table<K, V, H>::capacity()
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::size_type hash_table<K, V, H, A>::capacity()
     const noexcept {
   return table_.capacity();
 }
 
-template <typename K, typename V, typename H>
-bool hash_table<K, V, H>::empty() const noexcept {
+template <typename K, typename V, typename H, typename A>
+bool hash_table<K, V, H, A>::empty() const noexcept {
   return !size();
 }
 
-template <typename K, typename V, typename H>
-void hash_table<K, V, H>::clear() {
+template <typename K, typename V, typename H, typename A>
+void hash_table<K, V, H, A>::clear() {
   table_.clear();
 }
 
-template <typename K, typename V, typename H>
-bool hash_table<K, V, H>::contains(const key_type& key) const noexcept {
+template <typename K, typename V, typename H, typename A>
+bool hash_table<K, V, H, A>::contains(const key_type& key) const noexcept {
   int hash = compute_hash(key);
   auto& bucket = table_[hash];
 
@@ -115,8 +136,8 @@ bool hash_table<K, V, H>::contains(const key_type& key) const noexcept {
   return false;
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::iterator hash_table<K, V, H>::find(
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::iterator hash_table<K, V, H, A>::find(
     const key_type& key) {
   int hash = compute_hash(key);
   auto& bucket = table_[hash];
@@ -130,8 +151,8 @@ typename hash_table<K, V, H>::iterator hash_table<K, V, H>::find(
   return end();
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::iterator hash_table<K, V, H>::begin() {
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::iterator hash_table<K, V, H, A>::begin() {
   for (auto it = table_.begin(); it != table_.end(); ++it) {
     if (!it->empty()) {
       return iterator{it, table_.end(), it->begin()};
@@ -141,20 +162,20 @@ typename hash_table<K, V, H>::iterator hash_table<K, V, H>::begin() {
   return end();
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::iterator hash_table<K, V, H>::end() {
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::iterator hash_table<K, V, H, A>::end() {
   auto it = table_.end() - 1;
   for (; it >= table_.begin(); --it) {
     if (!it->empty()) {
-      return iterator{table_.end(), table_.end(), it->end()};
+      return iterator{table_.end(), table_.end(), --it->end()};
     }
   }
 
-  return iterator{table_.end(), table_.end(), it->end()};
+  return iterator{table_.end(), table_.end(), {}};
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::begin()
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::const_iterator hash_table<K, V, H, A>::begin()
     const {
   for (auto it = table_.begin(); it != table_.end(); ++it) {
     if (!it->empty()) {
@@ -165,20 +186,21 @@ typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::begin()
   return end();
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::end() const {
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::const_iterator hash_table<K, V, H, A>::end()
+    const {
   auto it = table_.end() - 1;
   for (; it >= table_.begin(); --it) {
     if (!it->empty()) {
-      return const_iterator{table_.end(), table_.end(), it->end()};
+      return const_iterator{table_.end(), table_.end(), --it->end()};
     }
   }
 
-  return const_iterator{table_.end(), table_.end(), it->end()};
+  return const_iterator{table_.end(), table_.end(), {}};
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::cbegin()
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::const_iterator hash_table<K, V, H, A>::cbegin()
     const {
   for (auto it = table_.begin(); it != table_.end(); ++it) {
     if (!it->empty()) {
@@ -189,20 +211,21 @@ typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::cbegin()
   return end();
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::cend() const {
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::const_iterator hash_table<K, V, H, A>::cend()
+    const {
   auto it = table_.end() - 1;
   for (; it >= table_.begin(); --it) {
     if (!it->empty()) {
-      return const_iterator{table_.end(), table_.end(), it->end()};
+      return const_iterator{table_.end(), table_.end(), --it->end()};
     }
   }
 
-  return const_iterator{table_.end(), table_.end(), it->end()};
+  return const_iterator{table_.end(), table_.end(), {}};
 }
 
-template <typename K, typename V, typename H>
-void hash_table<K, V, H>::assign(value_type& value) {
+template <typename K, typename V, typename H, typename A>
+void hash_table<K, V, H, A>::assign(value_type& value) {
   int hash = compute_hash(value.first);
   auto& bucket = table_[hash];
 
@@ -214,16 +237,16 @@ void hash_table<K, V, H>::assign(value_type& value) {
   }
 }
 
-template <typename K, typename V, typename H>
+template <typename K, typename V, typename H, typename A>
 template <typename... Args>
-s21::Vector<std::pair<typename hash_table<K, V, H>::iterator, bool>>
-hash_table<K, V, H>::insert_many(Args&&... args) {
+s21::Vector<std::pair<typename hash_table<K, V, H, A>::iterator, bool>>
+hash_table<K, V, H, A>::insert_many(Args&&... args) {
   return {insert(std::forward<Args>(args))...};
 }
 
-template <typename K, typename V, typename H>
-std::pair<typename hash_table<K, V, H>::iterator, bool>
-hash_table<K, V, H>::insert(const value_type& value) {
+template <typename K, typename V, typename H, typename A>
+std::pair<typename hash_table<K, V, H, A>::iterator, bool>
+hash_table<K, V, H, A>::insert(const value_type& value) {
   if (exceeds_limit()) {
     resize();
   }
@@ -241,19 +264,19 @@ hash_table<K, V, H>::insert(const value_type& value) {
   ++size_;
 
   return std::make_pair(
-      iterator(table_.begin() + hash, table_.end(), bucket.end()), true);
+      iterator(table_.begin() + hash, table_.end(), --bucket.end()), true);
 }
 
-template <typename K, typename V, typename H>
-std::pair<typename hash_table<K, V, H>::iterator, bool>
-hash_table<K, V, H>::insert(const key_type& key, const mapped_type& value) {
+template <typename K, typename V, typename H, typename A>
+std::pair<typename hash_table<K, V, H, A>::iterator, bool>
+hash_table<K, V, H, A>::insert(const key_type& key, const mapped_type& value) {
   std::pair<iterator, bool> it = insert(std::make_pair(key, value));
   return it;
 }
 
-template <typename K, typename V, typename H>
-std::pair<typename hash_table<K, V, H>::iterator, bool>
-hash_table<K, V, H>::insert_or_assign(const key_type& key,
+template <typename K, typename V, typename H, typename A>
+std::pair<typename hash_table<K, V, H, A>::iterator, bool>
+hash_table<K, V, H, A>::insert_or_assign(const key_type& key,
                                       const mapped_type& value) {
   value_type p = std::make_pair(key, value);
   std::pair<iterator, bool> it = insert(p);
@@ -265,9 +288,9 @@ hash_table<K, V, H>::insert_or_assign(const key_type& key,
   return it;
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::mapped_type& hash_table<K, V, H>::operator[](
-    const key_type& key) {
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::mapped_type&
+hash_table<K, V, H, A>::operator[](const key_type& key) {
   int hash = compute_hash(key);
   auto& bucket = table_[hash];
 
@@ -282,11 +305,11 @@ typename hash_table<K, V, H>::mapped_type& hash_table<K, V, H>::operator[](
   bucket.push_back(std::make_pair(key, mapped_type{}));
   ++size_;
 
-  return bucket.end()->second;
+  return (--bucket.end())->second;
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::mapped_type& hash_table<K, V, H>::at(
+template <typename K, typename V, typename H, typename A>
+typename hash_table<K, V, H, A>::mapped_type& hash_table<K, V, H, A>::at(
     const key_type& key) {
   if (!contains(key)) {
     throw std::out_of_range("Error: key doesn't exist");
@@ -295,13 +318,15 @@ typename hash_table<K, V, H>::mapped_type& hash_table<K, V, H>::at(
   return (*this)[key];
 }
 
-template <typename K, typename V, typename H>
-void hash_table<K, V, H>::swap(hash_table& other) {
+template <typename K, typename V, typename H, typename A>
+void hash_table<K, V, H, A>::swap(hash_table& other) {
   table_.swap(other.table_);
+  std::swap(size_, other.size_);
+  std::swap(load_factor, other.load_factor);
 }
 
-template <typename K, typename V, typename H>
-void hash_table<K, V, H>::erase(iterator pos) {
+template <typename K, typename V, typename H, typename A>
+void hash_table<K, V, H, A>::erase(iterator pos) {
   int hash = pos->first;
   auto& bucket = table_[hash];
 
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_intrusive_list_iterator.h"
+#include "s21_list_hook.h"
+
+namespace s21 {
+
+// Doubly linked list of objects that embed a ListHook, named by the member
+// pointer Hook. The list links the hooks themselves and never allocates or
+// copies: it holds references to objects owned elsewhere, which must
+// outlive their membership or unlink on destruction (ListHook does). With
+// several hooks an object can be in several lists at once, for example
+//
+//   struct Connection {
+//     ListHook active;
+//     ListHook per_client;
+//   };
+//   IntrusiveList<Connection, &Connection::active> active_list;
+//
+// An element can leave its list from anywhere through ListHook::unlink(),
+// in O(1). Because of that the list keeps no count: empty() is O(1) but
+// size() walks the list. T must be a standard-layout type, so that an
+// element can be found from the address of its hook.
+template <typename T, ListHook T::*Hook>
+class IntrusiveList {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using size_type = size_t;
+  using iterator = IntrusiveListIterator<T, Hook, false>;
+  using const_iterator = IntrusiveListIterator<T, Hook, true>;
+
+  IntrusiveList() noexcept = default;
+  IntrusiveList(const IntrusiveList&) = delete;
+  IntrusiveList(IntrusiveList&& other) noexcept { steal(other); }
+  ~IntrusiveList() noexcept { clear(); }
+
+  IntrusiveList& operator=(const IntrusiveList&) = delete;
+  IntrusiveList& operator=(IntrusiveList&& other) noexcept;
+
+  iterator begin() noexcept { return iterator(sentinel_.next()); }
+  iterator end() noexcept { return iterator(&sentinel_); }
+  const_iterator begin() const noexcept {
+    return const_iterator(sentinel_.next());
+  }
+  const_iterator end() const noexcept { return const_iterator(sentinel()); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // The position of an element that is in this list.
+  iterator iterator_to(reference value) noexcept {
+    return iterator(&(value.*Hook));
+  }
+  const_iterator iterator_to(const_reference value) const noexcept {
+    return const_iterator(const_cast<ListHook*>(&(value.*Hook)));
+  }
+
+  reference front() { return *begin(); }
+  const_reference front() const { return *begin(); }
+  reference back() { return *--end(); }
+  const_reference back() const { return *--end(); }
+
+  bool empty() const noexcept { return sentinel_.next() == &sentinel_; }
+  size_type size() const noexcept;
+
+  void clear() noexcept;
+  void push_back(reference value) { insert(end(), value); }
+  void push_front(reference value) { insert(begin(), value); }
+  void pop_back();
+  void pop_front();
+  iterator insert(const_iterator pos, reference value);
+  iterator erase(const_iterator pos) noexcept;
+
+  void splice(const_iterator pos, IntrusiveList& other) noexcept;
+  void splice(const_iterator pos, IntrusiveList& other,
+              const_iterator it) noexcept;
+  void splice(const_iterator pos, IntrusiveList& other, const_iterator first,
+              const_iterator last) noexcept;
+  void swap(IntrusiveList& other) noexcept;
+
+ private:
+  ListNodeBase* sentinel() const noexcept {
+    return const_cast<ListNodeBase*>(&sentinel_);
+  }
+  static void transfer(ListNodeBase* pos, ListNodeBase* first,
+                       ListNodeBase* last) noexcept;
+  void steal(IntrusiveList& other) noexcept;
+
+  ListNodeBase sentinel_;
+};
+
+template <typename T, ListHook T::*Hook>
+IntrusiveList<T, Hook>& IntrusiveList<T, Hook>::operator=(
+    IntrusiveList&& other) noexcept {
+  if (this != &other) {
+    clear();
+    steal(other);
+  }
+  return *this;
+}
+
+template <typename T, ListHook T::*Hook>
+typename IntrusiveList<T, Hook>::size_type IntrusiveList<T, Hook>::size()
+    const noexcept {
+  size_type count = 0;
+  for (const ListNodeBase* it = sentinel_.next(); it != &sentinel_;
+       it = it->next()) {
+    ++count;
+  }
+  return count;
+}
+
+// Unlinks every element; the elements themselves are untouched.
+template <typename T, ListHook T::*Hook>
+void IntrusiveList<T, Hook>::clear() noexcept {
+  while (!empty()) {
+    sentinel_.next()->unlink();
+  }
+}
+
+template <typename T, ListHook T::*Hook>
+void IntrusiveList<T, Hook>::pop_back() {
+  if (empty()) {
+    throw std::runtime_error("Error: List is empty");
+  }
+  sentinel_.prev()->unlink();
+}
+
+template <typename T, ListHook T::*Hook>
+void IntrusiveList<T, Hook>::pop_front() {
+  if (empty()) {
+    throw std::runtime_error("Error: List is empty");
+  }
+  sentinel_.next()->unlink();
+}
+
+template <typename T, ListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::insert(
+    const_iterator pos, reference value) {
+  ListHook& hook = value.*Hook;
+  if (hook.is_linked()) {
+    throw std::invalid_argument("Error: Element is already in a list");
+  }
+  hook.link_before(pos.node_);
+  return iterator(&hook);
+}
+
+template <typename T, ListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::erase(
+    const_iterator pos) noexcept {
+  ListNodeBase* next = pos.node_->next();
+  pos.node_->unlink();
+  return iterator(next);
+}
+
+template <typename T, ListHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(const_iterator pos,
+                                    IntrusiveList& other) noexcept {
+  if (this != &other && !other.empty()) {
+    transfer(pos.node_, other.sentinel_.next(), &other.sentinel_);
+  }
+}
+
+template <typename T, ListHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(const_iterator pos, IntrusiveList&,
+                                    const_iterator it) noexcept {
+  ListNodeBase* next = it.node_->next();
+  if (pos.node_ != it.node_ && pos.node_ != next) {
+    transfer(pos.node_, it.node_, next);
+  }
+}
+
+// Within one list, pos must not lie inside [first, last).
+template <typename T, ListHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(const_iterator pos, IntrusiveList&,
+                                    const_iterator first,
+                                    const_iterator last) noexcept {
+  if (first != last) {
+    transfer(pos.node_, first.node_, last.node_);
+  }
+}
+
+template <typename T, ListHook T::*Hook>
+void IntrusiveList<T, Hook>::swap(IntrusiveList& other) noexcept {
+  IntrusiveList tmp(std::move(other));
+  other.steal(*this);
+  steal(tmp);
+}
+
+// Moves the hooks [first, last) in front of pos.
+template <typename T, ListHook T::*Hook>
+void IntrusiveList<T, Hook>::transfer(ListNodeBase* pos, ListNodeBase* first,
+                                      ListNodeBase* last) noexcept {
+  ListNodeBase* back = last->prev();
+  first->prev()->set_next(last);
+  last->set_prev(first->prev());
+
+  ListNodeBase* before = pos->prev();
+  before->set_next(first);
+  first->set_prev(before);
+  back->set_next(pos);
+  pos->set_prev(back);
+}
+
+// Takes over the elements of other; this list must be empty.
+template <typename T, ListHook T::*Hook>
+void IntrusiveList<T, Hook>::steal(IntrusiveList& other) noexcept {
+  if (!other.empty()) {
+    transfer(&sentinel_, other.sentinel_.next(), &other.sentinel_);
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "s21_list_hook.h"
+
+namespace s21 {
+
+// Bidirectional iterator over an IntrusiveList: a pointer to the current
+// hook. end() is the list's sentinel and can be decremented. kConst selects
+// a const_iterator.
+template <typename T, ListHook T::*Hook, bool kConst>
+class IntrusiveListIterator {
+ public:
+  using value_type = T;
+  using pointer = std::conditional_t<kConst, const T*, T*>;
+  using reference = std::conditional_t<kConst, const T&, T&>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  IntrusiveListIterator() = default;
+  explicit IntrusiveListIterator(ListNodeBase* node) noexcept : node_(node) {}
+  template <bool kOther, typename = std::enable_if_t<kConst && !kOther>>
+  IntrusiveListIterator(
+      const IntrusiveListIterator<T, Hook, kOther>& other) noexcept
+      : node_(other.node_) {}
+
+  reference operator*() const noexcept { return *hook_owner<T, Hook>(node_); }
+  pointer operator->() const noexcept { return hook_owner<T, Hook>(node_); }
+
+  IntrusiveListIterator& operator++() noexcept {
+    node_ = node_->next();
+    return *this;
+  }
+  IntrusiveListIterator operator++(int) noexcept {
+    auto tmp{*this};
+    node_ = node_->next();
+    return tmp;
+  }
+  IntrusiveListIterator& operator--() noexcept {
+    node_ = node_->prev();
+    return *this;
+  }
+  IntrusiveListIterator operator--(int) noexcept {
+    auto tmp{*this};
+    node_ = node_->prev();
+    return tmp;
+  }
+
+  bool operator==(const IntrusiveListIterator& other) const noexcept {
+    return node_ == other.node_;
+  }
+  bool operator!=(const IntrusiveListIterator& other) const noexcept {
+    return node_ != other.node_;
+  }
+
+ private:
+  template <typename U, ListHook U::*, bool>
+  friend class IntrusiveListIterator;
+  template <typename U, ListHook U::*>
+  friend class IntrusiveList;
+
+  ListNodeBase* node_{nullptr};
+};
+
+}  // namespace s21
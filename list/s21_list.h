@@ -1,34 +1,73 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 #include "s21_list_iterator.h"
 #include "s21_list_node.h"
+#include "s21_list_node_pool.h"
 
 namespace s21 {
 
-template <typename T>
+// Doubly linked list over raw-pointer links. The nodes form a ring through
+// sentinel_, a link-only node embedded in the List, so no operation needs a
+// null check and end() can be decremented. Moving or swapping a List
+// re-points its first and last nodes at the new sentinel, which invalidates
+// end() iterators of both lists but no other iterator.
+//
+// A List can draw its nodes from a ListNodePool, created by reserve_nodes()
+// or shared with another List through the constructor or share_node_pool().
+// Nodes that were allocated before the pool was attached still go back to
+// the allocator, which the pool tells apart with owns(). The pool moves and
+// swaps along with the nodes. merge() and splice() relink nodes from another
+// list, so that list must use an equal allocator and either no pool or this
+// list's pool; otherwise they throw std::invalid_argument and change
+// nothing.
+template <typename T, typename Allocator = std::allocator<T>>
 class List {
   using node = ListNode<T>;
-  using node_ptr = std::shared_ptr<node>;
+  using node_base = ListNodeBase;
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using node_allocator = typename alloc_traits::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
 
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
   using iterator = ListIterator<T>;
   using const_iterator = ConstListIterator<T>;
-
-  List() = default;
-  explicit List(size_type n, const_reference value = value_type{});
-  List(std::initializer_list<value_type> const& items);
-  List(const List& other) = default;
-  List(List&& other) noexcept = default;
-  ~List() noexcept = default;
-
-  List<T>& operator=(const List& other) = default;
-  List<T>& operator=(List&& other) noexcept = default;
+  using node_pool_type = ListNodePool<T, Allocator>;
+
+  List() : List(Allocator()) {}
+  explicit List(const Allocator& alloc) noexcept : alloc_(alloc) {}
+  explicit List(std::shared_ptr<node_pool_type> pool,
+                const Allocator& alloc = Allocator()) noexcept
+      : pool_(std::move(pool)), alloc_(alloc) {}
+  explicit List(size_type n, const_reference value = value_type{},
+                const Allocator& alloc = Allocator());
+  List(std::initializer_list<value_type> const& items,
+       const Allocator& alloc = Allocator());
+  List(const List& other);
+  List(const List& other, const Allocator& alloc);
+  List(List&& other) noexcept;
+  List(List&& other, const Allocator& alloc);
+  ~List() noexcept { clear(); }
+
+  List& operator=(const List& other);
+  List& operator=(List&& other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value);
+
+  allocator_type get_allocator() const noexcept { return Allocator(alloc_); }
 
   iterator begin();
   iterator end();
@@ -44,6 +83,13 @@ class List {
   size_type size() const noexcept;
   size_type max_size() const noexcept;
 
+  void reserve_nodes(size_type count);
+  void shrink_nodes() noexcept;
+  void share_node_pool(const List& other);
+  bool can_take_nodes_of(const List& other) const noexcept;
+  void compact();
+  std::shared_ptr<node_pool_type> node_pool() const noexcept { return pool_; }
+
   void assign(iterator first, iterator last);
   void clear() noexcept;
 
@@ -60,364 +106,772 @@ class List {
   void pop_back();
   void push_front(const_reference value);
   void pop_front();
-  void swap(List<T>& other);
-  void merge(List<T>& other);
-  void splice(const_iterator pos, List<T>& other);
+  void swap(List& other);
+  void merge(List& other);
+  template <typename Compare>
+  void merge(List& other, Compare comp);
+  void splice(const_iterator pos, List& other);
+  void splice(const_iterator pos, List& other, const_iterator it);
+  void splice(const_iterator pos, List& other, const_iterator first,
+              const_iterator last);
   void reverse();
   void unique();
   void sort();
+  template <typename Compare>
+  void sort(Compare comp);
+
+ protected:
+  template <typename... Args>
+  node* make_node(Args&&... args);
+  void destroy_node(node_base* base) noexcept;
+  void release_node(node* ptr) noexcept;
+  template <typename... Args>
+  node_base* emplace_before(node_base* pos, Args&&... args);
+  void steal(List& other) noexcept;
+  node_base* compact_run(node_base* before, size_type count);
+  void check_can_take_nodes_of(const List& other) const;
+  static void transfer(node_base* pos, node_base* first,
+                       node_base* last) noexcept;
+  static node_base* cut_chain(node_base* head, size_type count) noexcept;
+  void close_chain() noexcept;
+  template <typename Compare>
+  static node_base* merge_chains(node_base* a, node_base* b, node_base* tail,
+                                 Compare& comp);
+
+  node_base* sentinel() const noexcept {
+    return const_cast<node_base*>(&sentinel_);
+  }
 
  private:
-  node_ptr head{};
-  node_ptr tail{};
+  node_base sentinel_;
   size_type size_{};
+  std::shared_ptr<node_pool_type> pool_;
+  node_allocator alloc_;
 };
 
-template <typename T>
-List<T>::List(size_type n, const_reference value) {
-  while (n--) {
-    push_back(value);
+template <typename T, typename A>
+template <typename... Args>
+typename List<T, A>::node* List<T, A>::make_node(Args&&... args) {
+  node* ptr;
+  try {
+    ptr = pool_ ? pool_->allocate() : node_traits::allocate(alloc_, 1);
+  } catch (std::bad_alloc& e) {
+    throw std::runtime_error("Error: failed to allocate memory");
+  }
+  try {
+    node_traits::construct(alloc_, ptr, std::forward<Args>(args)...);
+  } catch (...) {
+    release_node(ptr);
+    throw;
   }
+  return ptr;
 }
 
-template <typename T>
-typename List<T>::size_type List<T>::size() const noexcept {
+template <typename T, typename A>
+void List<T, A>::destroy_node(node_base* base) noexcept {
+  node* ptr = node::from(base);
+  node_traits::destroy(alloc_, ptr);
+  release_node(ptr);
+}
+
+template <typename T, typename A>
+void List<T, A>::release_node(node* ptr) noexcept {
+  if (pool_ && pool_->owns(ptr)) {
+    pool_->deallocate(ptr);
+  } else {
+    node_traits::deallocate(alloc_, ptr, 1);
+  }
+}
+
+// Builds an element from args and links it in front of pos.
+template <typename T, typename A>
+template <typename... Args>
+typename List<T, A>::node_base* List<T, A>::emplace_before(node_base* pos,
+                                                           Args&&... args) {
+  node* ptr = make_node(std::forward<Args>(args)...);
+  ptr->link_before(pos);
+  ++size_;
+  return ptr;
+}
+
+// Takes over the nodes and the node pool of other. The ring has to be
+// re-closed through this list's sentinel. This list must be empty.
+template <typename T, typename A>
+void List<T, A>::steal(List& other) noexcept {
+  pool_ = std::move(other.pool_);
+  if (other.empty()) {
+    return;
+  }
+  node_base* first = other.sentinel_.next();
+  node_base* last = other.sentinel_.prev();
+  sentinel_.set_next(first);
+  sentinel_.set_prev(last);
+  first->set_prev(&sentinel_);
+  last->set_next(&sentinel_);
+  size_ = other.size_;
+  other.sentinel_.set_next(&other.sentinel_);
+  other.sentinel_.set_prev(&other.sentinel_);
+  other.size_ = 0;
+}
+
+// Whether this list can free the nodes of other once they are relinked into
+// it. Nodes of other's allocator are fine even when this list has a pool,
+// since owns() sends them back to the allocator; nodes of a pool are not,
+// unless this list uses the same pool.
+template <typename T, typename A>
+bool List<T, A>::can_take_nodes_of(const List& other) const noexcept {
+  return alloc_ == other.alloc_ && (!other.pool_ || other.pool_ == pool_);
+}
+
+template <typename T, typename A>
+void List<T, A>::check_can_take_nodes_of(const List& other) const {
+  if (!can_take_nodes_of(other)) {
+    throw std::invalid_argument(
+        "Error: Lists do not share an allocator and node pool");
+  }
+}
+
+// Moves the nodes [first, last) in front of pos. They may come from another
+// list; fixing up both sizes is left to the caller.
+template <typename T, typename A>
+void List<T, A>::transfer(node_base* pos, node_base* first,
+                          node_base* last) noexcept {
+  node_base* back = last->prev();
+  first->prev()->set_next(last);
+  last->set_prev(first->prev());
+
+  node_base* before = pos->prev();
+  before->set_next(first);
+  first->set_prev(before);
+  back->set_next(pos);
+  pos->set_prev(back);
+}
+
+template <typename T, typename A>
+List<T, A>::List(size_type n, const_reference value, const A& alloc)
+    : alloc_(alloc) {
+  try {
+    while (n--) {
+      push_back(value);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+List<T, A>::List(const List& other)
+    : List(other, alloc_traits::select_on_container_copy_construction(
+                      A(other.alloc_))) {}
+
+template <typename T, typename A>
+List<T, A>::List(const List& other, const A& alloc) : alloc_(alloc) {
+  try {
+    for (auto& el : other) {
+      push_back(el);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+List<T, A>::List(List&& other) noexcept : alloc_(std::move(other.alloc_)) {
+  steal(other);
+}
+
+template <typename T, typename A>
+List<T, A>::List(List&& other, const A& alloc) : alloc_(alloc) {
+  if (alloc_ == other.alloc_) {
+    steal(other);
+    return;
+  }
+  try {
+    for (auto& el : other) {
+      insert_many_back(std::move(el));
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+  other.clear();
+}
+
+template <typename T, typename A>
+List<T, A>& List<T, A>::operator=(const List& other) {
+  if (this == &other) {
+    return *this;
+  }
+  clear();
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+    alloc_ = other.alloc_;
+  }
+  for (auto& el : other) {
+    push_back(el);
+  }
+
+  return *this;
+}
+
+template <typename T, typename A>
+List<T, A>& List<T, A>::operator=(List&& other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
+  if (this == &other) {
+    return *this;
+  }
+  clear();
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    alloc_ = std::move(other.alloc_);
+    steal(other);
+  } else if (alloc_ == other.alloc_) {
+    steal(other);
+  } else {
+    for (auto& el : other) {
+      insert_many_back(std::move(el));
+    }
+    other.clear();
+  }
+
+  return *this;
+}
+
+template <typename T, typename A>
+typename List<T, A>::size_type List<T, A>::size() const noexcept {
   return size_;
 }
 
-template <typename T>
-bool List<T>::empty() const noexcept {
+template <typename T, typename A>
+bool List<T, A>::empty() const noexcept {
   return !size();
 }
 
-template <typename T>
-typename List<T>::size_type List<T>::max_size() const noexcept {
+template <typename T, typename A>
+typename List<T, A>::size_type List<T, A>::max_size() const noexcept {
   return std::numeric_limits<size_type>::max();
 }
 
-template <typename T>
-void List<T>::clear() noexcept {
-  head = tail = nullptr;
-  size_ = 0;
+// Makes sure that count more elements can be inserted without going to the
+// allocator. The first call attaches a node pool to the list.
+template <typename T, typename A>
+void List<T, A>::reserve_nodes(size_type count) {
+  if (!pool_) {
+    pool_ = std::allocate_shared<node_pool_type>(A(alloc_), A(alloc_));
+  }
+  pool_->reserve(count);
 }
 
-template <typename T>
-void List<T>::push_back(const_reference value) {
-  insert_many_back(value);
+template <typename T, typename A>
+void List<T, A>::shrink_nodes() noexcept {
+  if (pool_) {
+    pool_->shrink();
+  }
 }
 
-template <typename T>
-template <typename... Args>
-void List<T>::insert_many_back(Args&&... args) {
-  node_ptr ptr{};
+// Makes this list draw its nodes from the pool of other, so that nodes can
+// be merged and spliced between the two. A list that already has a pool of
+// its own cannot switch, because its nodes would no longer be freed there.
+template <typename T, typename A>
+void List<T, A>::share_node_pool(const List& other) {
+  if (pool_ == other.pool_) {
+    return;
+  }
+  if (pool_) {
+    throw std::invalid_argument("Error: List already has a node pool");
+  }
+  pool_ = other.pool_;
+}
 
+// Rebuilds the list in pool slabs of up to node_pool_type::kMaxSlabNodes
+// nodes, each holding a stretch of the list in traversal order. One slab is
+// filled at a time and the nodes it replaces are freed right away, so the
+// extra memory never exceeds a slab; pool slabs left without live nodes go
+// back to the allocator along the way. Invalidates all iterators and
+// references. If an element cannot be moved without throwing, it is copied,
+// so T must be nothrow-move-constructible or copy-constructible; if a copy
+// fails, every element is still there and in order, but only part of the
+// list may have been compacted.
+template <typename T, typename A>
+void List<T, A>::compact() {
+  static_assert(std::is_nothrow_move_constructible_v<T> ||
+                    std::is_copy_constructible_v<T>,
+                "List::compact requires a nothrow-movable or copyable type");
+  if (!pool_ && !empty()) {
+    pool_ = std::allocate_shared<node_pool_type>(A(alloc_), A(alloc_));
+  }
+  size_type shrink_at = node_pool_type::kMaxSlabNodes;
+  node_base* before = &sentinel_;
+  for (size_type left = size_; left;) {
+    size_type count = std::min(left, node_pool_type::kMaxSlabNodes);
+    before = compact_run(before, count);
+    left -= count;
+    if (pool_->free_nodes() >= shrink_at) {
+      pool_->shrink();
+      shrink_at = std::max(pool_->free_nodes() * 2, shrink_at);
+    }
+  }
+  shrink_nodes();
+}
+
+// Replaces the count nodes after before with adjacent nodes of a new slab
+// and returns the last of them.
+template <typename T, typename A>
+typename List<T, A>::node_base* List<T, A>::compact_run(node_base* before,
+                                                        size_type count) {
+  node* run = pool_->allocate_run(count);
+  node_base* current = before->next();
+  size_type built = 0;
   try {
-    ptr = std::make_shared<node>(std::forward<Args>(args)...);
-  } catch (std::bad_alloc& e) {
-    throw std::runtime_error("Error: failed to allocate memory");
+    for (; built < count; ++built, current = current->next()) {
+      node_traits::construct(
+          alloc_, run + built,
+          std::move_if_noexcept(node::from(current)->get_data()));
+    }
+  } catch (...) {
+    while (built--) {
+      node_traits::destroy(alloc_, run + built);
+    }
+    pool_->deallocate_run(run);
+    throw;
   }
 
-  if (!head) {
-    head = tail = ptr;
-  } else {
-    ptr->set_prev(tail);
-    tail->set_next(ptr);
-    tail = ptr;
+  node_base* after = current;
+  current = before->next();
+  while (current != after) {
+    node_base* next = current->next();
+    destroy_node(current);
+    current = next;
+  }
+  for (size_type i = 0; i < count; ++i) {
+    run[i].set_prev(before);
+    before->set_next(run + i);
+    before = run + i;
   }
+  before->set_next(after);
+  after->set_prev(before);
+  return before;
+}
 
-  size_ += sizeof...(args);
+template <typename T, typename A>
+void List<T, A>::clear() noexcept {
+  node_base* current = sentinel_.next();
+  while (current != &sentinel_) {
+    node_base* next = current->next();
+    destroy_node(current);
+    current = next;
+  }
+  sentinel_.set_next(&sentinel_);
+  sentinel_.set_prev(&sentinel_);
+  size_ = 0;
 }
 
-template <typename T>
-void List<T>::pop_back() {
+template <typename T, typename A>
+void List<T, A>::push_back(const_reference value) {
+  emplace_before(&sentinel_, value);
+}
+
+// Each argument becomes one element, appended in order.
+template <typename T, typename A>
+template <typename... Args>
+void List<T, A>::insert_many_back(Args&&... args) {
+  (emplace_before(&sentinel_, std::forward<Args>(args)), ...);
+}
+
+template <typename T, typename A>
+void List<T, A>::pop_back() {
   if (empty()) {
     throw std::runtime_error("Error: List is empty");
   }
 
-  auto prev = tail->prev();
-  prev->set_next(nullptr);
-  tail = prev;
+  node_base* last = sentinel_.prev();
+  last->unlink();
+  destroy_node(last);
 
   --size_;
 }
 
-template <typename T>
-void List<T>::pop_front() {
+template <typename T, typename A>
+void List<T, A>::pop_front() {
   if (empty()) {
     throw std::runtime_error("Error: List is empty");
   }
 
-  head = head->next();
-  if (head) {
-    head->set_prev(nullptr);
-  } else {
-    tail = nullptr;
-  }
+  node_base* first = sentinel_.next();
+  first->unlink();
+  destroy_node(first);
 
   --size_;
 }
 
-template <typename T>
-void List<T>::push_front(const_reference value) {
-  insert_many_front(value);
+template <typename T, typename A>
+void List<T, A>::push_front(const_reference value) {
+  emplace_before(sentinel_.next(), value);
 }
 
-template <typename T>
+// Each argument is pushed to the front in turn, so the last one ends up
+// first.
+template <typename T, typename A>
 template <typename... Args>
-void List<T>::insert_many_front(Args&&... args) {
-  node_ptr ptr{};
+void List<T, A>::insert_many_front(Args&&... args) {
+  ((void)emplace_before(sentinel_.next(), std::forward<Args>(args)), ...);
+}
 
+template <typename T, typename A>
+List<T, A>::List(std::initializer_list<value_type> const& items,
+                 const A& alloc)
+    : alloc_(alloc) {
   try {
-    ptr = std::make_shared<node>(std::forward<Args>(args)...);
-  } catch (std::bad_alloc& e) {
-    throw std::runtime_error("Error: failed to allocate memory");
-  }
-
-  ptr->set_next(head);
-  if (head) {
-    head->set_prev(ptr);
-  }
-  head = ptr;
-
-  if (!tail) {
-    tail = ptr;
+    for (auto& el : items) {
+      push_back(el);
+    }
+  } catch (...) {
+    clear();
+    throw;
   }
-
-  size_ += sizeof...(args);
 }
 
-template <typename T>
-List<T>::List(std::initializer_list<value_type> const& items) {
-  for (auto& el : items) {
-    push_back(el);
-  }
+template <typename T, typename A>
+typename List<T, A>::iterator List<T, A>::begin() {
+  return iterator{sentinel_.next()};
 }
 
-template <typename T>
-typename List<T>::iterator List<T>::begin() {
-  return iterator{head};
+template <typename T, typename A>
+typename List<T, A>::const_iterator List<T, A>::begin() const {
+  return const_iterator{sentinel_.next()};
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::begin() const {
-  return const_iterator{head};
+template <typename T, typename A>
+typename List<T, A>::const_iterator List<T, A>::end() const {
+  return const_iterator{sentinel()};
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::end() const {
-  return const_iterator{tail, true};
+template <typename T, typename A>
+typename List<T, A>::iterator List<T, A>::end() {
+  return iterator{&sentinel_};
 }
 
-template <typename T>
-typename List<T>::iterator List<T>::end() {
-  return iterator{tail, true};
+template <typename T, typename A>
+typename List<T, A>::const_iterator List<T, A>::cbegin() const {
+  return begin();
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::cbegin() const {
-  return const_iterator{head};
+template <typename T, typename A>
+typename List<T, A>::const_iterator List<T, A>::cend() const {
+  return end();
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::cend() const {
-  return const_iterator{tail, true};
+template <typename T, typename A>
+typename List<T, A>::const_reference List<T, A>::front() {
+  return node::from(sentinel_.next())->get_data();
 }
 
-template <typename T>
-typename List<T>::const_reference List<T>::front() {
-  return head->get_data();
+template <typename T, typename A>
+typename List<T, A>::const_reference List<T, A>::back() {
+  return node::from(sentinel_.prev())->get_data();
 }
 
-template <typename T>
-typename List<T>::const_reference List<T>::back() {
-  return tail->get_data();
-}
-
-template <typename T>
-void List<T>::assign(iterator first, iterator last) {
+template <typename T, typename A>
+void List<T, A>::assign(iterator first, iterator last) {
   clear();
   for (; first != last; ++first) {
     push_back(*first);
   }
 }
 
-template <typename T>
-typename List<T>::iterator List<T>::insert(const_iterator pos,
-                                           const_reference value) {
-  return insert_many(pos, value);
+template <typename T, typename A>
+typename List<T, A>::iterator List<T, A>::insert(const_iterator pos,
+                                                 const_reference value) {
+  return iterator{emplace_before(pos.node_, value)};
 }
 
-template <typename T>
+// Inserts each argument as one element in front of pos, in order, and
+// returns an iterator to the first of them (pos if there are none).
+template <typename T, typename A>
 template <typename... Args>
-typename List<T>::iterator List<T>::insert_many(const_iterator pos,
-                                                Args&&... args) {
-  if (pos == cbegin()) {
-    insert_many_front(T(std::forward<Args>(args)...));
-    return begin();
-  }
-
-  if (pos == cend()) {
-    insert_many_back(std::forward<Args>(args)...);
-    return end();
+typename List<T, A>::iterator List<T, A>::insert_many(const_iterator pos,
+                                                      Args&&... args) {
+  node_base* first = pos.node_;
+  node_base* before = pos.node_->prev();
+  (emplace_before(pos.node_, std::forward<Args>(args)), ...);
+  if (sizeof...(args)) {
+    first = before->next();
   }
+  return iterator{first};
+}
 
-  node_ptr new_node{};
-  try {
-    new_node = std::make_shared<node>(T(std::forward<Args>(args)...));
-  } catch (std::bad_alloc& e) {
-    throw std::runtime_error("Error: Failed to allocate memory");
+// erase(end()) removes the last element.
+template <typename T, typename A>
+void List<T, A>::erase(iterator pos) {
+  if (pos == end()) {
+    pop_back();
+    return;
   }
 
-  node_ptr current = pos.get_ptr();
-  node_ptr prev = current->prev();
+  pos.node_->unlink();
+  destroy_node(pos.node_);
 
-  prev->set_next(new_node);
-  new_node->set_prev(prev);
-  new_node->set_next(current);
-  current->set_prev(new_node);
+  --size_;
+}
 
-  ++size_;
+template <typename T, typename A>
+void List<T, A>::swap(List& other) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
+  List tmp(alloc_);
+  tmp.steal(*this);
+  steal(other);
+  other.steal(tmp);
+}
 
-  return iterator(new_node);
+template <typename T, typename A>
+void List<T, A>::sort() {
+  sort(std::less<value_type>());
 }
 
-template <typename T>
-void List<T>::erase(iterator pos) {
-  if (pos == begin()) {
-    pop_front();
+// Bottom-up merge sort. The ring is opened into a chain linked through
+// next() only, runs of width 1, 2, 4, ... are merged pairwise, and the prev
+// links are rebuilt at the end. Only links are rewritten, so iterators and
+// references stay valid, and ties keep their order. If comp throws, the
+// pending runs are chained back into the ring: the list keeps all of its
+// elements, in an unspecified order.
+template <typename T, typename A>
+template <typename Compare>
+void List<T, A>::sort(Compare comp) {
+  if (size_ < 2) {
     return;
   }
-  if (pos == end()) {
-    pop_back();
-    return;
-  }
-
-  node_ptr current = pos.get_ptr();
-  node_ptr prev = current->prev();
-  node_ptr next = current->next();
-
-  prev->set_next(next);
-  next->set_prev(prev);
+  node_base* head = sentinel_.next();
+  sentinel_.prev()->set_next(nullptr);
 
-  --size_;
+  node_base* rest = nullptr;
+  try {
+    for (size_type width = 1; width < size_; width *= 2) {
+      rest = head;
+      node_base* tail = &sentinel_;
+      while (rest) {
+        node_base* left = rest;
+        node_base* right = cut_chain(left, width);
+        rest = cut_chain(right, width);
+        tail = merge_chains(left, right, tail, comp);
+      }
+      head = sentinel_.next();
+    }
+  } catch (...) {
+    node_base* last = &sentinel_;
+    while (last->next()) {
+      last = last->next();
+    }
+    last->set_next(rest);
+    close_chain();
+    throw;
+  }
+  close_chain();
 }
 
-template <typename T>
-void List<T>::swap(List<T>& other) {
-  std::swap(head, other.head);
-  std::swap(tail, other.tail);
-  std::swap(size_, other.size_);
+// Rebuilds the prev links of the chain hung after the sentinel, which ends
+// in nullptr, and closes it back into a ring.
+template <typename T, typename A>
+void List<T, A>::close_chain() noexcept {
+  node_base* prev = &sentinel_;
+  for (node_base* current = sentinel_.next(); current;
+       current = current->next()) {
+    current->set_prev(prev);
+    prev = current;
+  }
+  prev->set_next(&sentinel_);
+  sentinel_.set_prev(prev);
 }
 
-template <typename T>
-void List<T>::sort() {
-  if (empty()) {
-    return;
+// Ends the chain starting at head after count nodes and returns the rest,
+// or nullptr if the chain is not longer than that.
+template <typename T, typename A>
+typename List<T, A>::node_base* List<T, A>::cut_chain(
+    node_base* head, size_type count) noexcept {
+  for (; head && count > 1; --count) {
+    head = head->next();
   }
-  bool swapped;
-  do {
-    swapped = false;
-    node_ptr ptr = head;
-
-    while (ptr->next()) {
-      auto a = ptr->get_data();
-      auto b = ptr->next()->get_data();
-      if (a > b) {
-        ptr->set_data(b);
-        ptr->next()->set_data(a);
-        swapped = true;
+  if (!head) {
+    return nullptr;
+  }
+  node_base* rest = head->next();
+  head->set_next(nullptr);
+  return rest;
+}
+
+// Merges the chains a and b into one chain hung after tail and returns its
+// last node. Elements of a go first on ties. If comp throws, what is left of
+// a and then of b is hung after tail before the exception propagates.
+template <typename T, typename A>
+template <typename Compare>
+typename List<T, A>::node_base* List<T, A>::merge_chains(node_base* a,
+                                                         node_base* b,
+                                                         node_base* tail,
+                                                         Compare& comp) {
+  try {
+    while (a && b) {
+      if (comp(node::from(b)->get_data(), node::from(a)->get_data())) {
+        tail->set_next(b);
+        b = b->next();
+      } else {
+        tail->set_next(a);
+        a = a->next();
       }
-      ptr = ptr->next();
+      tail = tail->next();
+    }
+  } catch (...) {
+    tail->set_next(a);
+    while (tail->next()) {
+      tail = tail->next();
     }
-  } while (swapped);
+    tail->set_next(b);
+    throw;
+  }
+  tail->set_next(a ? a : b);
+  while (tail->next()) {
+    tail = tail->next();
+  }
+  return tail;
 }
 
-template <typename T>
-void List<T>::merge(List<T>& other) {
-  if (this == &other) {
+template <typename T, typename A>
+void List<T, A>::merge(List& other) {
+  merge(other, std::less<value_type>());
+}
+
+// Stable merge of two sorted lists that moves the nodes of other into this
+// one, leaving other empty. Runs of other that go in front of the same node
+// are transferred in one step, and the tail of other in one step too. Never
+// allocates; other must satisfy can_take_nodes_of(). Both sizes are updated
+// after every step, so if comp throws, both lists are still valid and hold
+// all of their elements between them.
+template <typename T, typename A>
+template <typename Compare>
+void List<T, A>::merge(List& other, Compare comp) {
+  if (this == &other || other.empty()) {
     return;
   }
-  if (empty()) {
-    assign(other.begin(), other.end());
-  } else {
-    for (auto& el : other) {
-      this->push_back(el);
+  check_can_take_nodes_of(other);
+
+  node_base* pos = sentinel_.next();
+  node_base* first = other.sentinel_.next();
+  node_base* other_end = &other.sentinel_;
+  while (first != other_end && pos != &sentinel_) {
+    if (comp(node::from(first)->get_data(), node::from(pos)->get_data())) {
+      node_base* last = first->next();
+      size_type count = 1;
+      while (last != other_end &&
+             comp(node::from(last)->get_data(), node::from(pos)->get_data())) {
+        last = last->next();
+        ++count;
+      }
+      transfer(pos, first, last);
+      size_ += count;
+      other.size_ -= count;
+      first = last;
+    } else {
+      pos = pos->next();
     }
   }
+  if (first != other_end) {
+    transfer(&sentinel_, first, other_end);
+  }
 
-  this->sort();
+  size_ += other.size_;
+  other.size_ = 0;
 }
 
-template <typename T>
-void List<T>::splice(const_iterator pos, List<T>& other) {
-  if (empty()) {
-    assign(other.begin(), other.end());
-  } else if (pos == cbegin()) {
-    auto tmp_head = head;
-    auto tmp_tail = tail;
-    size_type tmp_size = size();
+// The splice family moves nodes in front of pos by relinking them, without
+// allocating. Only the size of a range taken from another list costs a walk
+// over it. As with merge, other must satisfy can_take_nodes_of().
+template <typename T, typename A>
+void List<T, A>::splice(const_iterator pos, List& other) {
+  if (this == &other || other.empty()) {
+    return;
+  }
+  check_can_take_nodes_of(other);
 
-    assign(other.begin(), other.end());
+  transfer(pos.node_, other.sentinel_.next(), &other.sentinel_);
+  size_ += other.size_;
+  other.size_ = 0;
+}
 
-    tail->set_next(tmp_head);
-    tmp_head->set_prev(tail);
-    tail = tmp_tail;
+template <typename T, typename A>
+void List<T, A>::splice(const_iterator pos, List& other, const_iterator it) {
+  node_base* next = it.node_->next();
+  if (pos.node_ == it.node_ || pos.node_ == next) {
+    return;
+  }
+  if (this != &other) {
+    check_can_take_nodes_of(other);
+  }
 
-    size_ += tmp_size;
-  } else {
-    auto it = pos;
-    for (auto& el : other) {
-      it = insert(it, el);
-    }
+  transfer(pos.node_, it.node_, next);
+  if (this != &other) {
+    ++size_;
+    --other.size_;
   }
 }
 
-template <typename T>
-void List<T>::reverse() {
-  if (empty()) {
+// Within one list, pos must not lie inside [first, last).
+template <typename T, typename A>
+void List<T, A>::splice(const_iterator pos, List& other, const_iterator first,
+                        const_iterator last) {
+  if (first == last) {
     return;
   }
-
-  node_ptr it = head;
-  node_ptr next = nullptr;
-  node_ptr prev = nullptr;
-
-  while (it) {
-    next = it->next();
-    it->set_prev(next);
-    it->set_next(prev);
-
-    prev = it;
-    it = next;
+  if (this != &other) {
+    check_can_take_nodes_of(other);
+    size_type count = 0;
+    for (node_base* it = first.node_; it != last.node_; it = it->next()) {
+      ++count;
+    }
+    size_ += count;
+    other.size_ -= count;
   }
+  transfer(pos.node_, first.node_, last.node_);
+}
 
-  tail = head;
-  head = prev;
+// Swapping the links of every node, the sentinel included, reverses the
+// ring.
+template <typename T, typename A>
+void List<T, A>::reverse() {
+  node_base* current = &sentinel_;
+  do {
+    node_base* next = current->next();
+    current->set_next(current->prev());
+    current->set_prev(next);
+    current = next;
+  } while (current != &sentinel_);
 }
 
-template <typename T>
-void List<T>::unique() {
+template <typename T, typename A>
+void List<T, A>::unique() {
   if (empty()) {
     return;
   }
 
-  node_ptr current = head;
-  while (current && current->next()) {
-    if (current->get_data() == current->next()->get_data()) {
-      node_ptr duplicate = current->next();
-      while (duplicate && duplicate->next() &&
-             duplicate->next()->get_data() == current->get_data()) {
-        duplicate = duplicate->next();
-      }
-      current->set_next(duplicate->next());
-      if (duplicate->next()) {
-        duplicate->next()->set_prev(current);
-      } else {
-        tail = current;
-      }
+  node_base* current = sentinel_.next();
+  while (current->next() != &sentinel_) {
+    node_base* next = current->next();
+    if (node::from(current)->get_data() == node::from(next)->get_data()) {
+      next->unlink();
+      destroy_node(next);
+      --size_;
+    } else {
+      current = next;
     }
-    current = current->next();
   }
 }
 
+namespace pmr {
+
+template <typename T>
+using List = s21::List<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
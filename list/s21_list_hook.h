@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "s21_list_node.h"
+
+namespace s21 {
+
+// Links that a type embeds to become an element of IntrusiveList. One hook
+// lets an object be in one list at a time; several hooks let it be in as
+// many lists at once. Copying an object does not copy its memberships, so
+// a copied hook starts out unlinked. A hook unlinks itself when destroyed.
+class ListHook : public ListNodeBase {
+ public:
+  ListHook() noexcept = default;
+  ListHook(const ListHook&) noexcept : ListNodeBase() {}
+  ListHook& operator=(const ListHook&) noexcept { return *this; }
+  ~ListHook() noexcept { unlink(); }
+
+  bool is_linked() const noexcept { return next() != this; }
+
+  // Takes the element out of whatever list holds it, in O(1).
+  void unlink() noexcept {
+    if (is_linked()) {
+      ListNodeBase::unlink();
+    }
+  }
+};
+
+// Storage shaped like a T that never holds one: a union member is not
+// constructed unless asked to. hook_owner measures member offsets on it
+// without building a T.
+template <typename T>
+union HookProbe {
+  constexpr HookProbe() noexcept : none() {}
+  ~HookProbe() {}
+
+  char none;
+  T object;
+};
+
+template <typename T>
+inline const HookProbe<T> hook_probe{};
+
+// Recovers the object that embeds a hook through the member pointer Hook.
+// This is the usual offsetof-style trick, not portable C++: the probe's T
+// never starts its lifetime, so applying Hook to it is formally undefined,
+// just like casting raw bytes to T*. Compilers lay out members at fixed
+// offsets and the trick works in practice; the standard-layout requirement
+// keeps those offsets independent of the object, as offsetof does.
+template <typename T, ListHook T::*Hook>
+T* hook_owner(const ListNodeBase* hook) noexcept {
+  static_assert(std::is_standard_layout_v<T>,
+                "IntrusiveList requires a standard-layout element type");
+  const T& probe = hook_probe<T>.object;
+  const std::ptrdiff_t offset =
+      reinterpret_cast<const char*>(&(probe.*Hook)) -
+      reinterpret_cast<const char*>(&probe);
+  return reinterpret_cast<T*>(const_cast<char*>(
+      reinterpret_cast<const char*>(static_cast<const ListHook*>(hook)) -
+      offset));
+}
+
+}  // namespace s21
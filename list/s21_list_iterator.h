@@ -1,12 +1,17 @@
-#include <memory>
+#include <iterator>
+#include <type_traits>
 
 #include "s21_list_node.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator>
 class List;
 
+// A List iterator is a single node pointer and is trivially copyable, so
+// ++, -- and * each come down to one load. Like std::list iterators they are
+// unchecked: dereferencing end() or stepping past it is undefined. Stepping
+// back from end() reaches the last element.
 template <typename T>
 class BaseListIterator {
  public:
@@ -19,81 +24,33 @@ class BaseListIterator {
 
   BaseListIterator() = default;
 
-  std::weak_ptr<node> get_wp() const { return ptr_; }
-  bool get_end() const { return is_end_; }
+  ListNodeBase* get_node() const noexcept { return node_; }
 
-  explicit operator bool() const noexcept {
-    return !ptr_.expired() && is_end_ && get_ptr().get() != nullptr;
+  reference operator*() const noexcept {
+    return node::from(node_)->get_data();
   }
-  bool is_alive() const noexcept { return (bool)*this; }
-
-  reference operator*() const { return get_ref().get_data(); }
-  pointer operator->() const { return &get_ptr()->get_data(); }
-
- protected:
-  BaseListIterator(std::weak_ptr<node> ptr, bool is_end = false)
-      : ptr_(ptr), is_end_(is_end) {}
-
-  std::shared_ptr<node> get_shared() const {
-    try {
-      return ptr_.lock();
-    } catch (std::bad_weak_ptr& e) {
-      throw std::runtime_error(
-          "Error: Attempt to access an expired weak pointer");
-    }
+  pointer operator->() const noexcept {
+    return &node::from(node_)->get_data();
   }
 
-  std::shared_ptr<node> get_ptr() const { return get_shared(); }
-
-  node& get_ref() const { return *get_ptr(); }
-
-  void next() {
-    if (is_end_) {
-      throw std::out_of_range("Error: Attempt to access beyond list");
-    }
-
-    auto shared = get_shared();
-    auto next = shared->next();
-    if (next == nullptr) {
-      is_end_ = true;
-    }
-    ptr_ = next;
-  }
-
-  void prev() {
-    if (is_end_) {
-      is_end_ = false;
-      return;
-    }
-
-    auto shared = get_shared();
-    ptr_ = shared->prev();
-  }
-
-  bool equals(const BaseListIterator<T>& other) const {
-    if (ptr_.expired() && other.ptr_.expired()) {
-      return true;
-    }
+ protected:
+  explicit BaseListIterator(ListNodeBase* node) noexcept : node_(node) {}
 
-    if ((ptr_.expired() && is_end_) &&
-        (other.ptr_.expired() && other.is_end_)) {
-      return true;
-    }
-    if (is_end_ && other.is_end_) {
-      return true;
-    }
+  void next() noexcept { node_ = node_->next(); }
+  void prev() noexcept { node_ = node_->prev(); }
 
-    return !is_end_ && !other.is_end_ && get_ptr() == other.get_ptr();
+  bool equals(const BaseListIterator<T>& other) const noexcept {
+    return node_ == other.node_;
   }
 
-  std::weak_ptr<node> ptr_;
-  bool is_end_;
+  ListNodeBase* node_{nullptr};
 };
 
 template <typename T>
 class ListIterator : public BaseListIterator<T> {
  public:
-  friend class List<T>;
+  template <typename, typename>
+  friend class List;
   using base = BaseListIterator<T>;
   using value_type = typename base::value_type;
   using pointer = typename base::pointer;
@@ -109,10 +66,10 @@ class ListIterator : public BaseListIterator<T> {
   ListIterator<T>& operator=(const ListIterator<T>& other) = default;
   ListIterator<T>& operator=(ListIterator<T>&& other) noexcept = default;
 
-  ListIterator<T>& operator++();
-  ListIterator<T> operator++(int);
-  ListIterator<T>& operator--();
-  ListIterator<T> operator--(int);
+  ListIterator<T>& operator++() noexcept;
+  ListIterator<T> operator++(int) noexcept;
+  ListIterator<T>& operator--() noexcept;
+  ListIterator<T> operator--(int) noexcept;
 
   friend bool operator==(const ListIterator& a, const ListIterator& b) {
     return a.equals(b);
@@ -126,13 +83,13 @@ class ListIterator : public BaseListIterator<T> {
 };
 
 template <typename T>
-ListIterator<T>& ListIterator<T>::operator++() {
+ListIterator<T>& ListIterator<T>::operator++() noexcept {
   this->next();
   return *this;
 }
 
 template <typename T>
-ListIterator<T> ListIterator<T>::operator++(int) {
+ListIterator<T> ListIterator<T>::operator++(int) noexcept {
   auto tmp{*this};
   ++(*this);
 
@@ -140,13 +97,13 @@ ListIterator<T> ListIterator<T>::operator++(int) {
 }
 
 template <typename T>
-ListIterator<T>& ListIterator<T>::operator--() {
+ListIterator<T>& ListIterator<T>::operator--() noexcept {
   this->prev();
   return *this;
 }
 
 template <typename T>
-ListIterator<T> ListIterator<T>::operator--(int) {
+ListIterator<T> ListIterator<T>::operator--(int) noexcept {
   auto tmp{*this};
   --(*this);
 
@@ -156,7 +113,8 @@ ListIterator<T> ListIterator<T>::operator--(int) {
 template <typename T>
 class ConstListIterator : public BaseListIterator<const T> {
  public:
-  friend class List<T>;
+  template <typename, typename>
+  friend class List;
   using base = BaseListIterator<const T>;
   using value_type = typename base::value_type;
   using pointer = typename base::pointer;
@@ -167,10 +125,8 @@ class ConstListIterator : public BaseListIterator<const T> {
   ConstListIterator() = default;
   ConstListIterator(const ConstListIterator<T>& other) = default;
   ConstListIterator(ConstListIterator<T>&& other) noexcept = default;
-  ConstListIterator(const ListIterator<T>& other)
-      : base(other.get_wp(), other.get_end()) {}
-  ConstListIterator(ListIterator<T>&& other)
-      : base(other.get_wp(), other.get_end()) {}
+  ConstListIterator(const ListIterator<T>& other) noexcept
+      : base(other.get_node()) {}
   ~ConstListIterator() = default;
 
   ConstListIterator<T>& operator=(const ConstListIterator<T>& other) = default;
@@ -182,10 +138,10 @@ class ConstListIterator : public BaseListIterator<const T> {
     return *this;
   }
 
-  ConstListIterator<T>& operator++();
-  ConstListIterator<T> operator++(int);
-  ConstListIterator<T>& operator--();
-  ConstListIterator<T> operator--(int);
+  ConstListIterator<T>& operator++() noexcept;
+  ConstListIterator<T> operator++(int) noexcept;
+  ConstListIterator<T>& operator--() noexcept;
+  ConstListIterator<T> operator--(int) noexcept;
 
   friend bool operator==(const ConstListIterator& a,
                          const ConstListIterator& b) {
@@ -201,13 +157,13 @@ class ConstListIterator : public BaseListIterator<const T> {
 };
 
 template <typename T>
-ConstListIterator<T>& ConstListIterator<T>::operator++() {
+ConstListIterator<T>& ConstListIterator<T>::operator++() noexcept {
   this->next();
   return *this;
 }
 
 template <typename T>
-ConstListIterator<T> ConstListIterator<T>::operator++(int) {
+ConstListIterator<T> ConstListIterator<T>::operator++(int) noexcept {
   auto tmp{*this};
   ++(*this);
 
@@ -215,13 +171,13 @@ ConstListIterator<T> ConstListIterator<T>::operator++(int) {
 }
 
 template <typename T>
-ConstListIterator<T>& ConstListIterator<T>::operator--() {
+ConstListIterator<T>& ConstListIterator<T>::operator--() noexcept {
   this->prev();
   return *this;
 }
 
 template <typename T>
-ConstListIterator<T> ConstListIterator<T>::operator--(int) {
+ConstListIterator<T> ConstListIterator<T>::operator--(int) noexcept {
   auto tmp{*this};
   --(*this);
 
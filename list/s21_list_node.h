@@ -1,36 +1,64 @@
 #pragma once
 
-#include <memory>
+#include <utility>
 
 namespace s21 {
 
-template <typename T>
-class ListNode {
+// Links of a List node. A List keeps one of these as its sentinel: the list
+// is circular through it, so begin() is sentinel.next(), end() is the
+// sentinel itself and --end() is the last element. A lone base links to
+// itself, which is the empty list.
+class ListNodeBase {
  public:
-  ListNode() = default;
-  explicit ListNode(const T& data) noexcept : data_(data) {}
-  explicit ListNode(T&& data) noexcept : data_(data) {}
-  template <typename... Args>
-  explicit ListNode(Args&&... args) {
-    ((data_ = std::forward<Args>(args)), ...);
+  ListNodeBase() noexcept = default;
+  ListNodeBase(const ListNodeBase&) = delete;
+  ListNodeBase& operator=(const ListNodeBase&) = delete;
+
+  ListNodeBase* next() const noexcept { return next_; }
+  ListNodeBase* prev() const noexcept { return prev_; }
+  void set_next(ListNodeBase* next) noexcept { next_ = next; }
+  void set_prev(ListNodeBase* prev) noexcept { prev_ = prev; }
+
+  // Links this node in front of pos.
+  void link_before(ListNodeBase* pos) noexcept {
+    next_ = pos;
+    prev_ = pos->prev_;
+    prev_->next_ = this;
+    pos->prev_ = this;
   }
 
-  ListNode(const ListNode<T>& other) = default;
-  ListNode(ListNode<T>&& other) = default;
+  // Takes this node out of its list and leaves it linked to itself.
+  void unlink() noexcept {
+    prev_->next_ = next_;
+    next_->prev_ = prev_;
+    next_ = prev_ = this;
+  }
+
+ private:
+  ListNodeBase* next_{this};
+  ListNodeBase* prev_{this};
+};
+
+template <typename T>
+class ListNode : public ListNodeBase {
+ public:
+  template <typename... Args>
+  explicit ListNode(Args&&... args) : data_(std::forward<Args>(args)...) {}
   ~ListNode() noexcept = default;
 
-  std::shared_ptr<ListNode> next() noexcept { return next_; }
-  std::shared_ptr<ListNode> prev() noexcept { return prev_.lock(); }
+  static ListNode* from(ListNodeBase* base) noexcept {
+    return static_cast<ListNode*>(base);
+  }
+  static const ListNode* from(const ListNodeBase* base) noexcept {
+    return static_cast<const ListNode*>(base);
+  }
+
   T& get_data() & noexcept { return data_; }
   const T& get_data() const& noexcept { return data_; }
-  void set_data(const T data) { data_ = data; }
-  void set_next(std::shared_ptr<ListNode> next) { next_ = next; }
-  void set_prev(std::shared_ptr<ListNode> prev) { prev_ = prev; }
+  void set_data(const T& data) { data_ = data; }
 
  private:
-  std::shared_ptr<ListNode> next_;
-  std::weak_ptr<ListNode> prev_;
-  T data_{};
+  T data_;
 };
 
 }  // namespace s21
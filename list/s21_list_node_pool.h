@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "s21_list_node.h"
+
+namespace s21 {
+
+// Slab allocator for ListNode<T>. Nodes are carved out of slabs obtained
+// from Allocator, and freed nodes go to an intrusive free list that is
+// drained before a new slab is requested. Each new slab is as large as all
+// previous ones together, up to kMaxSlabNodes: growth stays geometric for
+// small pools, while a large pool never asks for one huge block and
+// shrink() can give memory back in bounded pieces. The slabs are kept in an
+// array sorted by address, so owns() is a binary search. Lists share a pool
+// through shared_ptr; the pool itself is not thread-safe.
+template <typename T, typename Allocator = std::allocator<T>>
+class ListNodePool {
+ public:
+  using node = ListNode<T>;
+  using size_type = size_t;
+
+  static constexpr size_type kMinSlabNodes = 16;
+  static constexpr size_type kMaxSlabNodes = size_type{1} << 16;
+
+  explicit ListNodePool(const Allocator& alloc = Allocator()) noexcept
+      : node_alloc_(alloc), slab_alloc_(alloc) {}
+  ListNodePool(const ListNodePool& other) = delete;
+  ListNodePool& operator=(const ListNodePool& other) = delete;
+  ~ListNodePool() noexcept { release(); }
+
+  // Storage for one node; the caller constructs it.
+  node* allocate();
+  void deallocate(node* ptr) noexcept;
+  // Storage for count adjacent nodes, in a slab of their own.
+  node* allocate_run(size_type count);
+  void deallocate_run(node* run) noexcept;
+  bool owns(const ListNodeBase* ptr) const noexcept;
+
+  void reserve(size_type count);
+  void shrink() noexcept;
+
+  size_type capacity() const noexcept { return capacity_; }
+  size_type free_nodes() const noexcept { return free_count_; }
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using node_allocator = typename alloc_traits::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  struct FreeNode {
+    FreeNode* next;
+  };
+  struct Slab {
+    node* nodes;
+    size_type count;
+    size_type free;
+  };
+  using slab_allocator = typename alloc_traits::template rebind_alloc<Slab>;
+  using slab_traits = std::allocator_traits<slab_allocator>;
+
+  static_assert(sizeof(node) >= sizeof(FreeNode));
+
+  Slab* find_slab(const void* ptr) const noexcept;
+  Slab* new_slab(size_type count);
+  void add_slab(size_type count);
+  void grow_index();
+  void free_slab(Slab* slab) noexcept;
+  void release() noexcept;
+
+  node_allocator node_alloc_;
+  slab_allocator slab_alloc_;
+  Slab* slabs_{nullptr};
+  size_type slab_count_{0};
+  size_type slab_capacity_{0};
+  FreeNode* free_{nullptr};
+  size_type free_count_{0};
+  size_type capacity_{0};
+};
+
+template <typename T, typename A>
+typename ListNodePool<T, A>::node* ListNodePool<T, A>::allocate() {
+  if (!free_) {
+    add_slab(std::min(std::max(capacity_, kMinSlabNodes), kMaxSlabNodes));
+  }
+  FreeNode* head = free_;
+  free_ = head->next;
+  --free_count_;
+  head->~FreeNode();
+
+  return reinterpret_cast<node*>(head);
+}
+
+template <typename T, typename A>
+void ListNodePool<T, A>::deallocate(node* ptr) noexcept {
+  free_ = ::new (static_cast<void*>(ptr)) FreeNode{free_};
+  ++free_count_;
+}
+
+template <typename T, typename A>
+bool ListNodePool<T, A>::owns(const ListNodeBase* ptr) const noexcept {
+  return find_slab(ptr) != nullptr;
+}
+
+// The slab whose nodes contain ptr, found as the last slab starting at or
+// below it.
+template <typename T, typename A>
+typename ListNodePool<T, A>::Slab* ListNodePool<T, A>::find_slab(
+    const void* ptr) const noexcept {
+  auto* address = static_cast<const char*>(ptr);
+  std::less<const char*> less;
+  Slab* after = std::upper_bound(
+      slabs_, slabs_ + slab_count_, address,
+      [&less](const char* value, const Slab& slab) {
+        return less(value, reinterpret_cast<const char*>(slab.nodes));
+      });
+  if (after == slabs_) {
+    return nullptr;
+  }
+  Slab* slab = after - 1;
+  auto* last = reinterpret_cast<const char*>(slab->nodes + slab->count);
+
+  return less(address, last) ? slab : nullptr;
+}
+
+// Makes sure the next count allocations are served without a new slab.
+// The shortfall is added in slabs of at most kMaxSlabNodes.
+template <typename T, typename A>
+void ListNodePool<T, A>::reserve(size_type count) {
+  while (free_count_ < count) {
+    add_slab(std::min(count - free_count_, kMaxSlabNodes));
+  }
+}
+
+template <typename T, typename A>
+typename ListNodePool<T, A>::node* ListNodePool<T, A>::allocate_run(
+    size_type count) {
+  return new_slab(count)->nodes;
+}
+
+// Gives back a whole run from allocate_run, none of whose nodes may be in
+// use.
+template <typename T, typename A>
+void ListNodePool<T, A>::deallocate_run(node* run) noexcept {
+  Slab* slab = find_slab(run);
+  if (slab && slab->nodes == run) {
+    free_slab(slab);
+  }
+}
+
+template <typename T, typename A>
+void ListNodePool<T, A>::add_slab(size_type count) {
+  node* nodes = new_slab(count)->nodes;
+  // Pushed back to front, so nodes are handed out in address order.
+  for (size_type i = count; i--;) {
+    deallocate(nodes + i);
+  }
+}
+
+// The returned slab stays valid until the next slab is added or freed.
+template <typename T, typename A>
+typename ListNodePool<T, A>::Slab* ListNodePool<T, A>::new_slab(
+    size_type count) {
+  if (slab_count_ == slab_capacity_) {
+    grow_index();
+  }
+  node* nodes;
+  try {
+    nodes = node_traits::allocate(node_alloc_, count);
+  } catch (std::bad_alloc& e) {
+    throw std::runtime_error("Error: failed to allocate memory");
+  }
+  Slab* end = slabs_ + slab_count_;
+  Slab* pos =
+      std::upper_bound(slabs_, end, nodes, [](node* value, const Slab& slab) {
+        return std::less<node*>()(value, slab.nodes);
+      });
+  std::copy_backward(pos, end, end + 1);
+  *pos = Slab{nodes, count, 0};
+  ++slab_count_;
+  capacity_ += count;
+  return pos;
+}
+
+template <typename T, typename A>
+void ListNodePool<T, A>::grow_index() {
+  size_type new_capacity = slab_capacity_ ? slab_capacity_ * 2 : 8;
+  Slab* index;
+  try {
+    index = slab_traits::allocate(slab_alloc_, new_capacity);
+  } catch (std::bad_alloc& e) {
+    throw std::runtime_error("Error: failed to allocate memory");
+  }
+  std::copy(slabs_, slabs_ + slab_count_, index);
+  if (slabs_) {
+    slab_traits::deallocate(slab_alloc_, slabs_, slab_capacity_);
+  }
+  slabs_ = index;
+  slab_capacity_ = new_capacity;
+}
+
+template <typename T, typename A>
+void ListNodePool<T, A>::free_slab(Slab* slab) noexcept {
+  capacity_ -= slab->count;
+  node_traits::deallocate(node_alloc_, slab->nodes, slab->count);
+  std::copy(slab + 1, slabs_ + slab_count_, slab);
+  --slab_count_;
+}
+
+// Returns every slab whose nodes are all free to the allocator.
+template <typename T, typename A>
+void ListNodePool<T, A>::shrink() noexcept {
+  for (Slab* slab = slabs_; slab != slabs_ + slab_count_; ++slab) {
+    slab->free = 0;
+  }
+  for (FreeNode* it = free_; it; it = it->next) {
+    ++find_slab(it)->free;
+  }
+
+  FreeNode** link = &free_;
+  while (*link) {
+    Slab* slab = find_slab(*link);
+    if (slab->free == slab->count) {
+      *link = (*link)->next;
+      --free_count_;
+    } else {
+      link = &(*link)->next;
+    }
+  }
+
+  size_type kept = 0;
+  for (size_type i = 0; i < slab_count_; ++i) {
+    Slab& slab = slabs_[i];
+    if (slab.free == slab.count) {
+      capacity_ -= slab.count;
+      node_traits::deallocate(node_alloc_, slab.nodes, slab.count);
+    } else {
+      slabs_[kept++] = slab;
+    }
+  }
+  slab_count_ = kept;
+}
+
+template <typename T, typename A>
+void ListNodePool<T, A>::release() noexcept {
+  for (size_type i = 0; i < slab_count_; ++i) {
+    node_traits::deallocate(node_alloc_, slabs_[i].nodes, slabs_[i].count);
+  }
+  if (slabs_) {
+    slab_traits::deallocate(slab_alloc_, slabs_, slab_capacity_);
+  }
+  slabs_ = nullptr;
+  slab_count_ = slab_capacity_ = 0;
+  free_ = nullptr;
+  free_count_ = 0;
+  capacity_ = 0;
+}
+
+}  // namespace s21
@@ -0,0 +1,583 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_unrolled_list_iterator.h"
+
+namespace s21 {
+
+// Doubly linked list whose nodes each hold up to kNodeCapacity elements in
+// an inline array, so that traversal walks mostly contiguous memory. Like
+// List, the nodes form a ring through an embedded sentinel.
+//
+// Pushing or popping at either end is O(1). insert and erase shift elements
+// within one node; a full node is split in half, and a node that drops to a
+// quarter full is merged with a neighbour when the two fit in half a node.
+// Insertions and erasures invalidate iterators into the affected nodes;
+// pushes and pops at the ends leave other iterators and all references to
+// other elements valid.
+//
+// Shifting, splitting and merging move elements between slots, and a move
+// that threw halfway would leave a node with a hole in it, so T must be
+// nothrow move constructible.
+template <typename T, typename Allocator = std::allocator<T>>
+class UnrolledList {
+  using node = UnrolledNode<T>;
+  using node_base = ListNodeBase;
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using node_allocator = typename alloc_traits::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "UnrolledList requires a nothrow move constructible type");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = UnrolledListIterator<T>;
+  using const_iterator = UnrolledListIterator<const T>;
+
+  static constexpr size_type kNodeCapacity = node::kCapacity;
+
+  UnrolledList() : UnrolledList(Allocator()) {}
+  explicit UnrolledList(const Allocator& alloc) noexcept : alloc_(alloc) {}
+  explicit UnrolledList(size_type count, const_reference value = value_type{},
+                        const Allocator& alloc = Allocator());
+  UnrolledList(std::initializer_list<value_type> const& items,
+               const Allocator& alloc = Allocator());
+  UnrolledList(const UnrolledList& other);
+  UnrolledList(const UnrolledList& other, const Allocator& alloc);
+  UnrolledList(UnrolledList&& other) noexcept;
+  UnrolledList(UnrolledList&& other, const Allocator& alloc);
+  ~UnrolledList() { clear(); }
+
+  UnrolledList& operator=(const UnrolledList& other);
+  UnrolledList& operator=(UnrolledList&& other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value);
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  iterator begin() noexcept { return make_iterator(sentinel_.next()); }
+  iterator end() noexcept { return iterator(&sentinel_, &sentinel_, 0); }
+  const_iterator begin() const noexcept {
+    return const_cast<UnrolledList*>(this)->begin();
+  }
+  const_iterator end() const noexcept {
+    return const_cast<UnrolledList*>(this)->end();
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  reference front() { return *begin(); }
+  const_reference front() const { return *begin(); }
+  reference back() { return *--end(); }
+  const_reference back() const { return *--end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+  size_type node_count() const noexcept { return node_count_; }
+
+  void clear() noexcept;
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(T&& value) { emplace_front(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+  template <typename... Args>
+  void insert_many_front(Args&&... args);
+  void pop_back();
+  void pop_front();
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  iterator insert(const_iterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+  }
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+  iterator erase(const_iterator pos);
+
+  void swap(UnrolledList& other);
+
+ private:
+  iterator make_iterator(node_base* base) noexcept {
+    return base == &sentinel_ ? end()
+                              : iterator(base, &sentinel_,
+                                         node::from(base)->head_);
+  }
+  node* make_node(node_base* pos, size_type offset);
+  void free_node(node* ptr) noexcept;
+  template <typename... Args>
+  void construct(T* slot, Args&&... args);
+  void destroy(T* slot) noexcept { alloc_traits::destroy(alloc_, slot); }
+  void relocate(T* from, T* to, size_type count);
+  iterator insert_at(node* target, size_type index, T&& value);
+  void split(node* full);
+  void merge_next(node* first, node_base*& it_node, size_type& it_index);
+  void steal(UnrolledList& other) noexcept;
+  void move_elements(UnrolledList& other);
+
+  node_base sentinel_;
+  size_type size_{0};
+  size_type node_count_{0};
+  Allocator alloc_;
+};
+
+template <typename T, typename A>
+UnrolledList<T, A>::UnrolledList(size_type count, const_reference value,
+                                 const A& alloc)
+    : alloc_(alloc) {
+  try {
+    while (count--) {
+      push_back(value);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+UnrolledList<T, A>::UnrolledList(std::initializer_list<value_type> const& items,
+                                 const A& alloc)
+    : alloc_(alloc) {
+  try {
+    for (auto& el : items) {
+      push_back(el);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+UnrolledList<T, A>::UnrolledList(const UnrolledList& other)
+    : UnrolledList(other, alloc_traits::select_on_container_copy_construction(
+                              other.alloc_)) {}
+
+template <typename T, typename A>
+UnrolledList<T, A>::UnrolledList(const UnrolledList& other, const A& alloc)
+    : alloc_(alloc) {
+  try {
+    for (auto& el : other) {
+      push_back(el);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+UnrolledList<T, A>::UnrolledList(UnrolledList&& other) noexcept
+    : alloc_(std::move(other.alloc_)) {
+  steal(other);
+}
+
+template <typename T, typename A>
+UnrolledList<T, A>::UnrolledList(UnrolledList&& other, const A& alloc)
+    : alloc_(alloc) {
+  if (alloc_ == other.alloc_) {
+    steal(other);
+    return;
+  }
+  try {
+    move_elements(other);
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+UnrolledList<T, A>& UnrolledList<T, A>::operator=(const UnrolledList& other) {
+  if (this == &other) {
+    return *this;
+  }
+  clear();
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+    alloc_ = other.alloc_;
+  }
+  for (auto& el : other) {
+    push_back(el);
+  }
+
+  return *this;
+}
+
+template <typename T, typename A>
+UnrolledList<T, A>& UnrolledList<T, A>::operator=(
+    UnrolledList&& other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
+  if (this == &other) {
+    return *this;
+  }
+  clear();
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    alloc_ = std::move(other.alloc_);
+    steal(other);
+  } else if (alloc_ == other.alloc_) {
+    steal(other);
+  } else {
+    move_elements(other);
+  }
+
+  return *this;
+}
+
+template <typename T, typename A>
+typename UnrolledList<T, A>::size_type UnrolledList<T, A>::max_size()
+    const noexcept {
+  return std::min<size_type>(alloc_traits::max_size(alloc_),
+                             std::numeric_limits<difference_type>::max());
+}
+
+template <typename T, typename A>
+void UnrolledList<T, A>::clear() noexcept {
+  node_base* current = sentinel_.next();
+  while (current != &sentinel_) {
+    node* ptr = node::from(current);
+    current = current->next();
+    for (size_type i = ptr->head_; i < ptr->tail_; ++i) {
+      destroy(ptr->slot(i));
+    }
+    free_node(ptr);
+  }
+  size_ = 0;
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename UnrolledList<T, A>::reference UnrolledList<T, A>::emplace_back(
+    Args&&... args) {
+  node_base* last = sentinel_.prev();
+  bool fresh = last == &sentinel_ || node::from(last)->tail_ == kNodeCapacity;
+  node* target = fresh ? make_node(&sentinel_, 0) : node::from(last);
+  try {
+    construct(target->slot(target->tail_), std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) {
+      free_node(target);
+    }
+    throw;
+  }
+  ++size_;
+  return *target->slot(target->tail_++);
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename UnrolledList<T, A>::reference UnrolledList<T, A>::emplace_front(
+    Args&&... args) {
+  node_base* first = sentinel_.next();
+  bool fresh = first == &sentinel_ || node::from(first)->head_ == 0;
+  node* target =
+      fresh ? make_node(sentinel_.next(), kNodeCapacity) : node::from(first);
+  try {
+    construct(target->slot(target->head_ - 1), std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) {
+      free_node(target);
+    }
+    throw;
+  }
+  ++size_;
+  return *target->slot(--target->head_);
+}
+
+template <typename T, typename A>
+template <typename... Args>
+void UnrolledList<T, A>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+// Each argument is pushed to the front in turn, so the last one ends up
+// first.
+template <typename T, typename A>
+template <typename... Args>
+void UnrolledList<T, A>::insert_many_front(Args&&... args) {
+  (emplace_front(std::forward<Args>(args)), ...);
+}
+
+template <typename T, typename A>
+void UnrolledList<T, A>::pop_back() {
+  if (empty()) {
+    throw std::runtime_error("Error: List is empty");
+  }
+  node* last = node::from(sentinel_.prev());
+  destroy(last->slot(--last->tail_));
+  --size_;
+  if (!last->size()) {
+    free_node(last);
+  }
+}
+
+template <typename T, typename A>
+void UnrolledList<T, A>::pop_front() {
+  if (empty()) {
+    throw std::runtime_error("Error: List is empty");
+  }
+  node* first = node::from(sentinel_.next());
+  destroy(first->slot(first->head_++));
+  --size_;
+  if (!first->size()) {
+    free_node(first);
+  }
+}
+
+// The new element is built before anything moves, so it may refer to an
+// element of the list.
+template <typename T, typename A>
+template <typename... Args>
+typename UnrolledList<T, A>::iterator UnrolledList<T, A>::emplace(
+    const_iterator pos, Args&&... args) {
+  if (pos == cend()) {
+    emplace_back(std::forward<Args>(args)...);
+    return --end();
+  }
+  if (pos == cbegin()) {
+    emplace_front(std::forward<Args>(args)...);
+    return begin();
+  }
+
+  T value(std::forward<Args>(args)...);
+  node* target = node::from(pos.node_);
+  size_type index = pos.index_;
+  if (target->head_ == 0 && target->tail_ == kNodeCapacity) {
+    split(target);
+    if (index >= target->tail_) {
+      index -= target->tail_;
+      target = node::from(target->next());
+    }
+  }
+  return insert_at(target, index, std::move(value));
+}
+
+// Puts value in front of slot index of a node that is not full, shifting
+// whichever side of index has room. The window of the node only grows once
+// the new element is in place.
+template <typename T, typename A>
+typename UnrolledList<T, A>::iterator UnrolledList<T, A>::insert_at(
+    node* target, size_type index, T&& value) {
+  if (target->head_ > 0 &&
+      (target->tail_ == kNodeCapacity ||
+       index - target->head_ < target->tail_ - index)) {
+    relocate(target->slot(target->head_), target->slot(target->head_ - 1),
+             index - target->head_);
+    construct(target->slot(--index), std::move(value));
+    --target->head_;
+  } else {
+    relocate(target->slot(index), target->slot(index + 1),
+             target->tail_ - index);
+    construct(target->slot(index), std::move(value));
+    ++target->tail_;
+  }
+  ++size_;
+  return iterator(target, &sentinel_, index);
+}
+
+// Moves the upper half of a full node into a new node after it.
+template <typename T, typename A>
+void UnrolledList<T, A>::split(node* full) {
+  node* upper = make_node(full->next(), 0);
+  size_type half = kNodeCapacity / 2;
+  relocate(full->slot(half), upper->slot(0), kNodeCapacity - half);
+  upper->tail_ = kNodeCapacity - half;
+  full->tail_ = half;
+}
+
+template <typename T, typename A>
+typename UnrolledList<T, A>::iterator UnrolledList<T, A>::erase(
+    const_iterator pos) {
+  node* target = node::from(pos.node_);
+  size_type index = pos.index_;
+  destroy(target->slot(index));
+  --size_;
+  if (index - target->head_ < target->tail_ - index - 1) {
+    relocate(target->slot(target->head_), target->slot(target->head_ + 1),
+             index - target->head_);
+    ++target->head_;
+    ++index;
+  } else {
+    relocate(target->slot(index + 1), target->slot(index),
+             target->tail_ - index - 1);
+    --target->tail_;
+  }
+
+  node_base* it_node = target;
+  if (!target->size()) {
+    it_node = target->next();
+    free_node(target);
+    return make_iterator(it_node);
+  }
+  if (index == target->tail_) {
+    it_node = target->next();
+    index = it_node == &sentinel_ ? 0 : node::from(it_node)->head_;
+  }
+
+  if (target->size() <= kNodeCapacity / 4) {
+    node_base* next = target->next();
+    node_base* prev = target->prev();
+    if (next != &sentinel_ &&
+        target->size() + node::from(next)->size() <= kNodeCapacity / 2) {
+      merge_next(target, it_node, index);
+    } else if (prev != &sentinel_ &&
+               target->size() + node::from(prev)->size() <=
+                   kNodeCapacity / 2) {
+      merge_next(node::from(prev), it_node, index);
+    }
+  }
+  return it_node == &sentinel_ ? end() : iterator(it_node, &sentinel_, index);
+}
+
+// Packs the elements of first and of the node after it into first, freeing
+// the second node. (it_node, it_index) is moved along if it points into
+// either of them.
+template <typename T, typename A>
+void UnrolledList<T, A>::merge_next(node* first, node_base*& it_node,
+                                    size_type& it_index) {
+  node* second = node::from(first->next());
+  size_type count = first->size();
+  if (it_node == first) {
+    it_index -= first->head_;
+  } else if (it_node == second) {
+    it_node = first;
+    it_index = count + it_index - second->head_;
+  }
+
+  relocate(first->slot(first->head_), first->slot(0), count);
+  relocate(second->slot(second->head_), first->slot(count), second->size());
+  first->head_ = 0;
+  first->tail_ = count + second->size();
+  second->head_ = second->tail_ = 0;
+  free_node(second);
+}
+
+template <typename T, typename A>
+void UnrolledList<T, A>::swap(UnrolledList& other) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
+  UnrolledList tmp(alloc_);
+  tmp.steal(*this);
+  steal(other);
+  other.steal(tmp);
+}
+
+// Allocates an empty node whose free slots start at offset and links it in
+// front of pos.
+template <typename T, typename A>
+typename UnrolledList<T, A>::node* UnrolledList<T, A>::make_node(
+    node_base* pos, size_type offset) {
+  node_allocator node_alloc(alloc_);
+  node* ptr;
+  try {
+    ptr = node_traits::allocate(node_alloc, 1);
+  } catch (std::bad_alloc& e) {
+    throw std::runtime_error("Error: Failed to allocate memory");
+  }
+  ::new (static_cast<void*>(ptr)) node(offset);
+  ptr->link_before(pos);
+  ++node_count_;
+  return ptr;
+}
+
+template <typename T, typename A>
+void UnrolledList<T, A>::free_node(node* ptr) noexcept {
+  ptr->unlink();
+  ptr->~node();
+  node_allocator node_alloc(alloc_);
+  node_traits::deallocate(node_alloc, ptr, 1);
+  --node_count_;
+}
+
+template <typename T, typename A>
+template <typename... Args>
+void UnrolledList<T, A>::construct(T* slot, Args&&... args) {
+  alloc_traits::construct(alloc_, slot, std::forward<Args>(args)...);
+}
+
+// Moves count elements from one run of slots to another, leaving the source
+// slots empty. The runs may overlap, so elements are taken in the order that
+// never overwrites one still to be moved.
+template <typename T, typename A>
+void UnrolledList<T, A>::relocate(T* from, T* to, size_type count) {
+  if (from == to) {
+    return;
+  }
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memmove(static_cast<void*>(to), static_cast<const void*>(from),
+                 count * sizeof(T));
+  } else if (std::less<T*>()(to, from)) {
+    for (size_type i = 0; i < count; ++i) {
+      construct(to + i, std::move(from[i]));
+      destroy(from + i);
+    }
+  } else {
+    for (size_type i = count; i--;) {
+      construct(to + i, std::move(from[i]));
+      destroy(from + i);
+    }
+  }
+}
+
+// Takes over the nodes of other; this list must be empty.
+template <typename T, typename A>
+void UnrolledList<T, A>::steal(UnrolledList& other) noexcept {
+  if (other.sentinel_.next() != &other.sentinel_) {
+    node_base* first = other.sentinel_.next();
+    node_base* last = other.sentinel_.prev();
+    sentinel_.set_next(first);
+    sentinel_.set_prev(last);
+    first->set_prev(&sentinel_);
+    last->set_next(&sentinel_);
+    other.sentinel_.set_next(&other.sentinel_);
+    other.sentinel_.set_prev(&other.sentinel_);
+  }
+  size_ = other.size_;
+  node_count_ = other.node_count_;
+  other.size_ = other.node_count_ = 0;
+}
+
+// Fallback of the moves when other's nodes belong to an unequal allocator.
+template <typename T, typename A>
+void UnrolledList<T, A>::move_elements(UnrolledList& other) {
+  for (auto& el : other) {
+    emplace_back(std::move(el));
+  }
+  other.clear();
+}
+
+namespace pmr {
+
+template <typename T>
+using UnrolledList =
+    s21::UnrolledList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
+}  // namespace s21
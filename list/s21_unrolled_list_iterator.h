@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "s21_list_node.h"
+
+namespace s21 {
+
+// Elements per UnrolledList node: two cache lines worth, and never fewer
+// than 8.
+template <typename T>
+constexpr size_t unrolled_node_capacity() noexcept {
+  constexpr size_t kTargetBytes = 128;
+  return sizeof(T) * 8 > kTargetBytes ? 8 : kTargetBytes / sizeof(T);
+}
+
+template <typename T, typename Allocator>
+class UnrolledList;
+
+// One UnrolledList node: the links plus an inline array of slots, of which
+// [head_, tail_) hold live elements. Keeping a gap at either end lets pushes
+// at the front of the list fill a node from the back.
+template <typename T>
+class UnrolledNode : public ListNodeBase {
+ public:
+  static constexpr size_t kCapacity = unrolled_node_capacity<T>();
+
+  explicit UnrolledNode(size_t offset) noexcept
+      : head_(offset), tail_(offset) {}
+
+  static UnrolledNode* from(ListNodeBase* base) noexcept {
+    return static_cast<UnrolledNode*>(base);
+  }
+
+  T* slot(size_t index) noexcept {
+    return reinterpret_cast<T*>(storage_) + index;
+  }
+  size_t head() const noexcept { return head_; }
+  size_t tail() const noexcept { return tail_; }
+  size_t size() const noexcept { return tail_ - head_; }
+
+ private:
+  template <typename, typename>
+  friend class UnrolledList;
+
+  size_t head_;
+  size_t tail_;
+  alignas(T) unsigned char storage_[sizeof(T) * kCapacity];
+};
+
+// Bidirectional iterator over an UnrolledList: a node and a slot index in
+// it. end() is the sentinel with index 0, and decrementing it reaches the
+// last element, as with List. T is const-qualified for const iterators.
+template <typename T>
+class UnrolledListIterator {
+  using node = UnrolledNode<std::remove_const_t<T>>;
+
+ public:
+  using value_type = std::remove_const_t<T>;
+  using pointer = T*;
+  using reference = T&;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  UnrolledListIterator() = default;
+  UnrolledListIterator(ListNodeBase* node, const ListNodeBase* sentinel,
+                       size_t index) noexcept
+      : node_(node), sentinel_(sentinel), index_(index) {}
+  template <typename U, typename = std::enable_if_t<
+                            std::is_same_v<const U, T> &&
+                            !std::is_same_v<U, T>>>
+  UnrolledListIterator(const UnrolledListIterator<U>& other) noexcept
+      : node_(other.node_), sentinel_(other.sentinel_), index_(other.index_) {}
+
+  reference operator*() const noexcept {
+    return *node::from(node_)->slot(index_);
+  }
+  pointer operator->() const noexcept { return &**this; }
+
+  UnrolledListIterator& operator++() noexcept;
+  UnrolledListIterator operator++(int) noexcept;
+  UnrolledListIterator& operator--() noexcept;
+  UnrolledListIterator operator--(int) noexcept;
+
+  bool operator==(const UnrolledListIterator& other) const noexcept {
+    return node_ == other.node_ && index_ == other.index_;
+  }
+  bool operator!=(const UnrolledListIterator& other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  template <typename>
+  friend class UnrolledListIterator;
+  template <typename, typename>
+  friend class UnrolledList;
+
+  ListNodeBase* node_{nullptr};
+  const ListNodeBase* sentinel_{nullptr};
+  size_t index_{0};
+};
+
+template <typename T>
+UnrolledListIterator<T>& UnrolledListIterator<T>::operator++() noexcept {
+  if (++index_ == node::from(node_)->tail()) {
+    node_ = node_->next();
+    index_ = node_ == sentinel_ ? 0 : node::from(node_)->head();
+  }
+  return *this;
+}
+
+template <typename T>
+UnrolledListIterator<T> UnrolledListIterator<T>::operator++(int) noexcept {
+  auto tmp{*this};
+  ++(*this);
+  return tmp;
+}
+
+template <typename T>
+UnrolledListIterator<T>& UnrolledListIterator<T>::operator--() noexcept {
+  if (node_ == sentinel_ || index_ == node::from(node_)->head()) {
+    node_ = node_->prev();
+    index_ = node::from(node_)->tail();
+  }
+  --index_;
+  return *this;
+}
+
+template <typename T>
+UnrolledListIterator<T> UnrolledListIterator<T>::operator--(int) noexcept {
+  auto tmp{*this};
+  --(*this);
+  return tmp;
+}
+
+}  // namespace s21
@@ -4,32 +4,42 @@
 
 namespace s21 {
 
-template <typename K, typename V, typename H = std::hash<K>>
+template <typename K, typename V, typename H = std::hash<K>,
+          typename Allocator = std::allocator<std::pair<K, V>>>
 class Map {
  public:
-  using table = s21::hash_table<K, V, H>;
+  using table = s21::hash_table<K, V, H, Allocator>;
   using key_type = K;
   using mapped_type = V;
   using value_type = std::pair<key_type, mapped_type>;
+  using allocator_type = typename table::allocator_type;
   using reference = value_type&;
   using iterator = typename table::iterator;
   using size_type = size_t;
 
   Map() = default;
+  explicit Map(const allocator_type& alloc) : t(alloc) {}
 
-  Map(std::initializer_list<value_type> const& items) {
+  Map(std::initializer_list<value_type> const& items,
+      const allocator_type& alloc = allocator_type())
+      : t(alloc) {
     for (auto& it : items) {
       t[it.first] = it.second;
     }
   }
 
   Map(const Map& other) = default;
+  Map(const Map& other, const allocator_type& alloc) : t(other.t, alloc) {}
   Map(Map&& other) noexcept = default;
+  Map(Map&& other, const allocator_type& alloc)
+      : t(std::move(other.t), alloc) {}
   ~Map() noexcept = default;
 
   Map& operator=(const Map& other) = default;
   Map& operator=(Map&& other) noexcept = default;
 
+  allocator_type get_allocator() const noexcept { return t.get_allocator(); }
+
   size_type size() const noexcept { return t.size(); }
   bool empty() const noexcept { return t.empty(); }
   void clear() { return t.clear(); }
@@ -65,4 +75,11 @@ class Map {
   table t;
 };
 
+namespace pmr {
+
+template <typename K, typename V, typename H = std::hash<K>>
+using Map = s21::Map<K, V, H, std::pmr::polymorphic_allocator<std::pair<K, V>>>;
+
+}  // namespace pmr
+
 }  // namespace s21
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Allocator that places every block on an Align-byte boundary and rounds its
+// size up to a whole number of Align-byte blocks. With Align set to the SIMD
+// width, kernels can use aligned loads throughout and may read a full vector
+// from the last, partially used block without leaving the allocation.
+template <typename T, size_t Align = 64>
+class AlignedAllocator {
+  static_assert(Align && (Align & (Align - 1)) == 0,
+                "Alignment must be a power of two");
+  static_assert(Align >= alignof(T),
+                "Alignment must not be weaker than the type's own");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, Align>;
+  };
+
+  static constexpr size_t alignment = Align;
+
+  AlignedAllocator() noexcept = default;
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept {}
+
+  T* allocate(size_type n);
+  void deallocate(T* p, size_type n) noexcept;
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<size_type>::max() - Align) / sizeof(T);
+  }
+
+  static constexpr size_type padded_bytes(size_type n) noexcept {
+    return (n * sizeof(T) + Align - 1) / Align * Align;
+  }
+};
+
+template <typename T, size_t Align>
+T* AlignedAllocator<T, Align>::allocate(size_type n) {
+  if (n > max_size()) {
+    throw std::bad_array_new_length();
+  }
+  return static_cast<T*>(
+      ::operator new(padded_bytes(n), std::align_val_t{Align}));
+}
+
+template <typename T, size_t Align>
+void AlignedAllocator<T, Align>::deallocate(T* p, size_type n) noexcept {
+  ::operator delete(p, padded_bytes(n), std::align_val_t{Align});
+}
+
+template <typename T, typename U, size_t Align>
+bool operator==(const AlignedAllocator<T, Align>&,
+                const AlignedAllocator<U, Align>&) noexcept {
+  return true;
+}
+
+template <typename T, typename U, size_t Align>
+bool operator!=(const AlignedAllocator<T, Align>&,
+                const AlignedAllocator<U, Align>&) noexcept {
+  return false;
+}
+
+}  // namespace s21
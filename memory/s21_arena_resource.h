@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+#include "s21_resource_stats.h"
+
+namespace s21 {
+
+// Monotonic bump allocator. Deallocation is a no-op, memory comes back only
+// through reset() or release(), which makes it a good fit for containers
+// whose lifetime is bounded by a single request.
+class ArenaResource : public std::pmr::memory_resource {
+ public:
+  static constexpr size_t kDefaultChunkSize = 4096;
+
+  explicit ArenaResource(
+      size_t chunk_size = kDefaultChunkSize,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+  ArenaResource(
+      void* buffer, size_t size,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+  ArenaResource(const ArenaResource& other) = delete;
+  ArenaResource& operator=(const ArenaResource& other) = delete;
+  ~ArenaResource() override;
+
+  void reset() noexcept;
+  void release() noexcept;
+
+  size_t remaining() const noexcept { return left_; }
+  const ResourceStats& stats() const noexcept { return stats_; }
+  std::pmr::memory_resource* upstream_resource() const noexcept {
+    return upstream_;
+  }
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  struct Chunk {
+    Chunk* next;
+    size_t size;
+  };
+
+  void grow(size_t bytes, size_t alignment);
+  void free_chunks(Chunk* chunk) noexcept;
+  void rewind(char* begin, size_t size) noexcept;
+
+  std::pmr::memory_resource* upstream_;
+  char* initial_buffer_{nullptr};
+  size_t initial_size_{0};
+  size_t chunk_size_;
+  size_t next_chunk_size_;
+  Chunk* chunks_{nullptr};
+  char* cur_{nullptr};
+  size_t left_{0};
+  ResourceStats stats_;
+};
+
+inline ArenaResource::ArenaResource(size_t chunk_size,
+                                    std::pmr::memory_resource* upstream)
+    : upstream_(upstream),
+      chunk_size_(std::max(chunk_size, sizeof(Chunk) * 2)),
+      next_chunk_size_(chunk_size_) {}
+
+inline ArenaResource::ArenaResource(void* buffer, size_t size,
+                                    std::pmr::memory_resource* upstream)
+    : ArenaResource(kDefaultChunkSize, upstream) {
+  initial_buffer_ = static_cast<char*>(buffer);
+  initial_size_ = size;
+  rewind(initial_buffer_, initial_size_);
+}
+
+inline ArenaResource::~ArenaResource() { release(); }
+
+inline void ArenaResource::rewind(char* begin, size_t size) noexcept {
+  cur_ = begin;
+  left_ = size;
+  stats_.bytes_in_use = 0;
+}
+
+inline void ArenaResource::free_chunks(Chunk* chunk) noexcept {
+  while (chunk) {
+    Chunk* next = chunk->next;
+    size_t size = chunk->size;
+    upstream_->deallocate(chunk, size, alignof(std::max_align_t));
+    stats_.record_upstream_release(size);
+    chunk = next;
+  }
+}
+
+// Keeps the most recent (and largest) chunk so that an arena reset between
+// requests of similar size stops talking to upstream after warm-up.
+inline void ArenaResource::reset() noexcept {
+  if (!chunks_) {
+    rewind(initial_buffer_, initial_size_);
+    return;
+  }
+  free_chunks(chunks_->next);
+  chunks_->next = nullptr;
+  rewind(reinterpret_cast<char*>(chunks_ + 1), chunks_->size - sizeof(Chunk));
+}
+
+inline void ArenaResource::release() noexcept {
+  free_chunks(chunks_);
+  chunks_ = nullptr;
+  next_chunk_size_ = chunk_size_;
+  rewind(initial_buffer_, initial_size_);
+}
+
+inline void ArenaResource::grow(size_t bytes, size_t alignment) {
+  size_t size = std::max(next_chunk_size_, sizeof(Chunk) + bytes + alignment);
+  void* memory = upstream_->allocate(size, alignof(std::max_align_t));
+  stats_.record_upstream(size);
+
+  chunks_ = ::new (memory) Chunk{chunks_, size};
+  cur_ = reinterpret_cast<char*>(chunks_ + 1);
+  left_ = size - sizeof(Chunk);
+  next_chunk_size_ = size * 2;
+}
+
+inline void* ArenaResource::do_allocate(size_t bytes, size_t alignment) {
+  void* p = cur_;
+  size_t space = left_;
+  if (!cur_ || !std::align(alignment, bytes, p, space)) {
+    grow(bytes, alignment);
+    p = cur_;
+    space = left_;
+    std::align(alignment, bytes, p, space);
+  }
+  cur_ = static_cast<char*>(p) + bytes;
+  left_ = space - bytes;
+  stats_.record_allocation(bytes);
+
+  return p;
+}
+
+// Bytes stay accounted as in use until the next reset(), since the arena
+// cannot hand them out again before that.
+inline void ArenaResource::do_deallocate(void*, size_t, size_t) {
+  ++stats_.deallocations;
+}
+
+inline bool ArenaResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace s21
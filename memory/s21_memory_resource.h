@@ -0,0 +1,6 @@
+#pragma once
+
+#include "s21_arena_resource.h"
+#include "s21_node_pool_resource.h"
+#include "s21_resource_stats.h"
+#include "s21_thread_cache_resource.h"
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
+#include "../list/s21_list_node.h"
+#include "s21_resource_stats.h"
+
+namespace s21 {
+
+// Size of one List<T> node allocation: the two links and the payload.
+template <typename T>
+inline constexpr size_t list_node_block_size = sizeof(ListNode<T>);
+
+// hash_table buckets are Lists of key/value pairs.
+template <typename K, typename V>
+inline constexpr size_t hash_node_block_size =
+    list_node_block_size<std::pair<K, V>>;
+
+// Pool of equally sized blocks carved out of larger upstream chunks. Freed
+// blocks go to an intrusive free list and are handed out again before any
+// new chunk is requested. Requests that do not fit a block are forwarded to
+// the upstream resource unchanged. Not thread-safe, like
+// std::pmr::unsynchronized_pool_resource.
+class NodePoolResource : public std::pmr::memory_resource {
+ public:
+  static constexpr size_t kDefaultBlocksPerChunk = 256;
+
+  explicit NodePoolResource(
+      size_t block_size, size_t blocks_per_chunk = kDefaultBlocksPerChunk,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+  NodePoolResource(const NodePoolResource& other) = delete;
+  NodePoolResource& operator=(const NodePoolResource& other) = delete;
+  ~NodePoolResource() override;
+
+  void reserve(size_t blocks);
+  void release() noexcept;
+
+  size_t block_size() const noexcept { return block_size_; }
+  size_t free_blocks() const noexcept { return free_count_ + carve_left_; }
+  const ResourceStats& stats() const noexcept { return stats_; }
+  std::pmr::memory_resource* upstream_resource() const noexcept {
+    return upstream_;
+  }
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+  struct Chunk {
+    Chunk* next;
+    size_t size;
+  };
+
+  static constexpr size_t kChunkAlign = alignof(std::max_align_t);
+  static constexpr size_t kHeaderSize =
+      (sizeof(Chunk) + kChunkAlign - 1) / kChunkAlign * kChunkAlign;
+
+  bool fits(size_t bytes, size_t alignment) const noexcept {
+    return bytes <= block_size_ && alignment <= block_align_;
+  }
+  void add_chunk(size_t blocks);
+
+  std::pmr::memory_resource* upstream_;
+  size_t block_size_;
+  size_t block_align_;
+  size_t blocks_per_chunk_;
+  Chunk* chunks_{nullptr};
+  FreeBlock* free_{nullptr};
+  size_t free_count_{0};
+  char* carve_{nullptr};
+  size_t carve_left_{0};
+  ResourceStats stats_;
+};
+
+inline NodePoolResource::NodePoolResource(size_t block_size,
+                                          size_t blocks_per_chunk,
+                                          std::pmr::memory_resource* upstream)
+    : upstream_(upstream),
+      block_size_(std::max(block_size, sizeof(FreeBlock))),
+      blocks_per_chunk_(std::max<size_t>(blocks_per_chunk, 1)) {
+  block_size_ = (block_size_ + alignof(FreeBlock) - 1) / alignof(FreeBlock) *
+                alignof(FreeBlock);
+  // Blocks sit at multiples of block_size_ from a max-aligned base, so their
+  // guaranteed alignment is the lowest set bit of the block size.
+  block_align_ = std::min(block_size_ & (~block_size_ + 1), kChunkAlign);
+}
+
+inline NodePoolResource::~NodePoolResource() { release(); }
+
+inline void NodePoolResource::add_chunk(size_t blocks) {
+  size_t size = kHeaderSize + blocks * block_size_;
+  void* memory = upstream_->allocate(size, kChunkAlign);
+  stats_.record_upstream(size);
+
+  // Whatever was left in the previous chunk is not lost, it goes to the
+  // free list before the new chunk takes over carving.
+  for (; carve_left_; --carve_left_, carve_ += block_size_) {
+    free_ = ::new (carve_) FreeBlock{free_};
+    ++free_count_;
+  }
+  chunks_ = ::new (memory) Chunk{chunks_, size};
+  carve_ = static_cast<char*>(memory) + kHeaderSize;
+  carve_left_ = blocks;
+}
+
+inline void NodePoolResource::reserve(size_t blocks) {
+  if (blocks > free_blocks()) {
+    add_chunk(blocks - free_blocks());
+  }
+}
+
+inline void NodePoolResource::release() noexcept {
+  while (chunks_) {
+    Chunk* next = chunks_->next;
+    size_t size = chunks_->size;
+    upstream_->deallocate(chunks_, size, kChunkAlign);
+    stats_.record_upstream_release(size);
+    chunks_ = next;
+  }
+  free_ = nullptr;
+  free_count_ = 0;
+  carve_ = nullptr;
+  carve_left_ = 0;
+  stats_.bytes_in_use = 0;
+}
+
+inline void* NodePoolResource::do_allocate(size_t bytes, size_t alignment) {
+  if (!fits(bytes, alignment)) {
+    void* p = upstream_->allocate(bytes, alignment);
+    stats_.record_upstream(bytes);
+    stats_.record_allocation(bytes);
+    return p;
+  }
+
+  void* p = nullptr;
+  if (free_) {
+    p = free_;
+    free_ = free_->next;
+    --free_count_;
+    ++stats_.reused_blocks;
+  } else {
+    if (!carve_left_) {
+      add_chunk(blocks_per_chunk_);
+    }
+    p = carve_;
+    carve_ += block_size_;
+    --carve_left_;
+  }
+  stats_.record_allocation(block_size_);
+
+  return p;
+}
+
+inline void NodePoolResource::do_deallocate(void* p, size_t bytes,
+                                            size_t alignment) {
+  if (!fits(bytes, alignment)) {
+    upstream_->deallocate(p, bytes, alignment);
+    stats_.record_upstream_release(bytes);
+    stats_.record_deallocation(bytes);
+    return;
+  }
+
+  free_ = ::new (p) FreeBlock{free_};
+  ++free_count_;
+  stats_.record_deallocation(block_size_);
+}
+
+inline bool NodePoolResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace s21
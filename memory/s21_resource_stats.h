@@ -0,0 +1,40 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+
+// Usage counters shared by the bundled memory resources. upstream_bytes is the
+// amount currently held from the upstream resource, the other byte counters
+// describe what was handed out to containers.
+struct ResourceStats {
+  size_t allocations{0};
+  size_t deallocations{0};
+  size_t bytes_allocated{0};
+  size_t bytes_in_use{0};
+  size_t peak_bytes_in_use{0};
+  size_t reused_blocks{0};
+  size_t upstream_allocations{0};
+  size_t upstream_bytes{0};
+
+  void record_allocation(size_t bytes) noexcept {
+    ++allocations;
+    bytes_allocated += bytes;
+    bytes_in_use += bytes;
+    peak_bytes_in_use = std::max(peak_bytes_in_use, bytes_in_use);
+  }
+  void record_deallocation(size_t bytes) noexcept {
+    ++deallocations;
+    bytes_in_use -= bytes;
+  }
+  void record_upstream(size_t bytes) noexcept {
+    ++upstream_allocations;
+    upstream_bytes += bytes;
+  }
+  void record_upstream_release(size_t bytes) noexcept {
+    upstream_bytes -= bytes;
+  }
+};
+
+}  // namespace s21
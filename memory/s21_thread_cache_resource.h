@@ -0,0 +1,316 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "s21_resource_stats.h"
+
+namespace s21 {
+
+// Thread-safe small-object pool with a per-thread front cache. Blocks of up
+// to kMaxCachedSize bytes are rounded to power-of-two size classes; each
+// thread keeps its own free lists and only takes the shared lock to refill
+// or to hand back a surplus. Larger requests go straight to upstream.
+//
+// Blocks parked in the cache of a thread that has exited stay unused until
+// the resource itself is destroyed, at which point every chunk is returned.
+// A thread's cache entry for a destroyed resource is dropped the next time
+// that thread switches to another resource, so threads that outlive many
+// short-lived resources do not accumulate dead entries.
+class ThreadCachingResource : public std::pmr::memory_resource {
+ public:
+  static constexpr size_t kMinCachedSize = 16;
+  static constexpr size_t kMaxCachedSize = 512;
+  static constexpr size_t kDefaultCachedBlocks = 64;
+
+  explicit ThreadCachingResource(
+      size_t cached_blocks = kDefaultCachedBlocks,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+  ThreadCachingResource(const ThreadCachingResource& other) = delete;
+  ThreadCachingResource& operator=(const ThreadCachingResource& other) =
+      delete;
+  ~ThreadCachingResource() override;
+
+  ResourceStats stats() const noexcept;
+  std::pmr::memory_resource* upstream_resource() const noexcept {
+    return upstream_;
+  }
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  static constexpr size_t kClasses = 6;  // 16, 32, ..., 512 bytes
+
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+  struct Chunk {
+    Chunk* next;
+    size_t size;
+  };
+  struct LocalCache {
+    FreeBlock* heads[kClasses]{};
+    size_t counts[kClasses]{};
+  };
+  struct AtomicStats {
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> deallocations{0};
+    std::atomic<size_t> bytes_allocated{0};
+    std::atomic<size_t> bytes_in_use{0};
+    std::atomic<size_t> peak_bytes_in_use{0};
+    std::atomic<size_t> reused_blocks{0};
+    std::atomic<size_t> upstream_allocations{0};
+    std::atomic<size_t> upstream_bytes{0};
+  };
+
+  static size_t class_of(size_t bytes) noexcept;
+  static size_t class_size(size_t cls) noexcept {
+    return kMinCachedSize << cls;
+  }
+  // Ids of the resources alive right now, and a counter bumped whenever
+  // one is destroyed so threads know when to sweep their caches.
+  struct Registry {
+    std::mutex mutex;
+    std::unordered_set<uint64_t> live;
+    std::atomic<uint64_t> retired{0};
+  };
+
+  static uint64_t next_id() noexcept;
+  static Registry& registry();
+  static void drop_retired(std::unordered_map<uint64_t, LocalCache>& caches);
+
+  LocalCache& local() const;
+  void refill(LocalCache& cache, size_t cls);
+  void flush(LocalCache& cache, size_t cls, size_t keep);
+  void record_allocation(size_t bytes) noexcept;
+  void record_deallocation(size_t bytes) noexcept;
+
+  std::pmr::memory_resource* upstream_;
+  size_t cached_blocks_;
+  uint64_t id_;
+
+  std::mutex mutex_;
+  FreeBlock* central_[kClasses]{};
+  Chunk* chunks_{nullptr};
+
+  AtomicStats stats_;
+};
+
+inline ThreadCachingResource::ThreadCachingResource(
+    size_t cached_blocks, std::pmr::memory_resource* upstream)
+    : upstream_(upstream),
+      cached_blocks_(std::max<size_t>(cached_blocks, 2)),
+      id_(next_id()) {
+  Registry& ids = registry();
+  std::lock_guard<std::mutex> lock(ids.mutex);
+  ids.live.insert(id_);
+}
+
+inline ThreadCachingResource::~ThreadCachingResource() {
+  Registry& ids = registry();
+  {
+    std::lock_guard<std::mutex> lock(ids.mutex);
+    ids.live.erase(id_);
+  }
+  ++ids.retired;
+
+  while (chunks_) {
+    Chunk* next = chunks_->next;
+    upstream_->deallocate(chunks_, chunks_->size, alignof(std::max_align_t));
+    chunks_ = next;
+  }
+}
+
+inline uint64_t ThreadCachingResource::next_id() noexcept {
+  static std::atomic<uint64_t> counter{0};
+  return ++counter;
+}
+
+inline ThreadCachingResource::Registry& ThreadCachingResource::registry() {
+  static Registry instance;
+  return instance;
+}
+
+// The blocks of a dead resource went back upstream with its chunks, so its
+// entries are simply forgotten.
+inline void ThreadCachingResource::drop_retired(
+    std::unordered_map<uint64_t, LocalCache>& caches) {
+  Registry& ids = registry();
+  std::lock_guard<std::mutex> lock(ids.mutex);
+  for (auto it = caches.begin(); it != caches.end();) {
+    if (ids.live.count(it->first)) {
+      ++it;
+    } else {
+      it = caches.erase(it);
+    }
+  }
+}
+
+inline size_t ThreadCachingResource::class_of(size_t bytes) noexcept {
+  size_t cls = 0;
+  while (class_size(cls) < bytes) {
+    ++cls;
+  }
+  return cls;
+}
+
+// Caches are keyed by a never reused id rather than by address, so a new
+// resource constructed where an old one lived does not inherit stale blocks.
+// Dead entries are swept only on a switch between resources, and only if a
+// resource was destroyed since the last sweep, so the hot path is untouched.
+inline ThreadCachingResource::LocalCache& ThreadCachingResource::local()
+    const {
+  thread_local std::unordered_map<uint64_t, LocalCache> caches;
+  thread_local uint64_t last_id = 0;
+  thread_local LocalCache* last = nullptr;
+  thread_local uint64_t seen_retired = 0;
+
+  if (last_id != id_) {
+    uint64_t retired = registry().retired.load();
+    if (retired != seen_retired) {
+      seen_retired = retired;
+      drop_retired(caches);
+    }
+    last = &caches[id_];
+    last_id = id_;
+  }
+  return *last;
+}
+
+inline void ThreadCachingResource::refill(LocalCache& cache, size_t cls) {
+  size_t batch = cached_blocks_ / 2;
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (!central_[cls]) {
+    size_t block = class_size(cls);
+    size_t header =
+        (sizeof(Chunk) + alignof(std::max_align_t) - 1) /
+        alignof(std::max_align_t) * alignof(std::max_align_t);
+    size_t size = header + block * batch;
+    void* memory = upstream_->allocate(size, alignof(std::max_align_t));
+    ++stats_.upstream_allocations;
+    stats_.upstream_bytes += size;
+
+    chunks_ = ::new (memory) Chunk{chunks_, size};
+    char* p = static_cast<char*>(memory) + header;
+    for (size_t i = 0; i < batch; ++i, p += block) {
+      central_[cls] = ::new (p) FreeBlock{central_[cls]};
+    }
+  }
+
+  for (size_t i = 0; i < batch && central_[cls]; ++i) {
+    FreeBlock* block = central_[cls];
+    central_[cls] = block->next;
+    block->next = cache.heads[cls];
+    cache.heads[cls] = block;
+    ++cache.counts[cls];
+  }
+}
+
+inline void ThreadCachingResource::flush(LocalCache& cache, size_t cls,
+                                         size_t keep) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  while (cache.counts[cls] > keep) {
+    FreeBlock* block = cache.heads[cls];
+    cache.heads[cls] = block->next;
+    --cache.counts[cls];
+    block->next = central_[cls];
+    central_[cls] = block;
+  }
+}
+
+inline void ThreadCachingResource::record_allocation(size_t bytes) noexcept {
+  ++stats_.allocations;
+  stats_.bytes_allocated += bytes;
+  size_t in_use = stats_.bytes_in_use += bytes;
+  size_t peak = stats_.peak_bytes_in_use.load(std::memory_order_relaxed);
+  while (in_use > peak &&
+         !stats_.peak_bytes_in_use.compare_exchange_weak(peak, in_use)) {
+  }
+}
+
+inline void ThreadCachingResource::record_deallocation(size_t bytes) noexcept {
+  ++stats_.deallocations;
+  stats_.bytes_in_use -= bytes;
+}
+
+inline void* ThreadCachingResource::do_allocate(size_t bytes,
+                                                size_t alignment) {
+  if (bytes > kMaxCachedSize || alignment > alignof(std::max_align_t)) {
+    void* p = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      p = upstream_->allocate(bytes, alignment);
+    }
+    ++stats_.upstream_allocations;
+    stats_.upstream_bytes += bytes;
+    record_allocation(bytes);
+    return p;
+  }
+
+  size_t cls = class_of(bytes);
+  LocalCache& cache = local();
+  if (cache.heads[cls]) {
+    ++stats_.reused_blocks;
+  } else {
+    refill(cache, cls);
+  }
+
+  FreeBlock* block = cache.heads[cls];
+  cache.heads[cls] = block->next;
+  --cache.counts[cls];
+  record_allocation(class_size(cls));
+
+  return block;
+}
+
+inline void ThreadCachingResource::do_deallocate(void* p, size_t bytes,
+                                                 size_t alignment) {
+  if (bytes > kMaxCachedSize || alignment > alignof(std::max_align_t)) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      upstream_->deallocate(p, bytes, alignment);
+    }
+    stats_.upstream_bytes -= bytes;
+    record_deallocation(bytes);
+    return;
+  }
+
+  size_t cls = class_of(bytes);
+  LocalCache& cache = local();
+  cache.heads[cls] = ::new (p) FreeBlock{cache.heads[cls]};
+  if (++cache.counts[cls] > cached_blocks_) {
+    flush(cache, cls, cached_blocks_ / 2);
+  }
+  record_deallocation(class_size(cls));
+}
+
+inline bool ThreadCachingResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+inline ResourceStats ThreadCachingResource::stats() const noexcept {
+  ResourceStats snapshot;
+  snapshot.allocations = stats_.allocations;
+  snapshot.deallocations = stats_.deallocations;
+  snapshot.bytes_allocated = stats_.bytes_allocated;
+  snapshot.bytes_in_use = stats_.bytes_in_use;
+  snapshot.peak_bytes_in_use = stats_.peak_bytes_in_use;
+  snapshot.reused_blocks = stats_.reused_blocks;
+  snapshot.upstream_allocations = stats_.upstream_allocations;
+  snapshot.upstream_bytes = stats_.upstream_bytes;
+  return snapshot;
+}
+
+}  // namespace s21
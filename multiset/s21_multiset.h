@@ -2,32 +2,43 @@
 
 namespace s21 {
 
-template <typename K, typename H = std::hash<K>>
+template <typename K, typename H = std::hash<K>,
+          typename Allocator = std::allocator<K>>
 class Multiset {
  public:
-  using table = hash_table<K, K, H>;
+  using table = hash_table<K, K, H, Allocator>;
   using key_type = K;
   using mapped_type = K;
   using value_type = std::pair<key_type, mapped_type>;
+  using allocator_type = typename table::allocator_type;
   using reference = value_type&;
   using iterator = typename table::iterator;
   using size_type = size_t;
 
   Multiset() = default;
+  explicit Multiset(const allocator_type& alloc) : t(alloc) {}
 
-  Multiset(std::initializer_list<mapped_type> const& items) {
+  Multiset(std::initializer_list<mapped_type> const& items,
+           const allocator_type& alloc = allocator_type())
+      : t(alloc) {
     for (auto& it : items) {
       t[it] = it;
     }
   }
 
   Multiset(const Multiset& other) = default;
+  Multiset(const Multiset& other, const allocator_type& alloc)
+      : t(other.t, alloc) {}
   Multiset(Multiset&& other) = default;
+  Multiset(Multiset&& other, const allocator_type& alloc)
+      : t(std::move(other.t), alloc) {}
   ~Multiset() noexcept = default;
 
   Multiset& operator=(const Multiset& other) = default;
   Multiset& operator=(Multiset&& other) noexcept = default;
 
+  allocator_type get_allocator() const noexcept { return t.get_allocator(); }
+
   iterator begin() { return t.begin(); }
   iterator end() { return t.end(); }
 
@@ -53,4 +64,11 @@ class Multiset {
   table t;
 };
 
+namespace pmr {
+
+template <typename K, typename H = std::hash<K>>
+using Multiset = s21::Multiset<K, H, std::pmr::polymorphic_allocator<K>>;
+
+}  // namespace pmr
+
 }  // namespace s21
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <type_traits>
+#include <utility>
+
 #include "s21_list.h"
+#include "s21_ring_buffer.h"
+#include "s21_span.h"
 
 namespace s21 {
 
@@ -12,6 +17,37 @@ class queue {
   using const_reference = typename sequence_::const_reference;
   using size_type = typename sequence_::size_type;
 
+ private:
+  template <typename Alloc>
+  using uses_alloc_t =
+      std::enable_if_t<std::uses_allocator<sequence_, Alloc>::value>;
+
+  // Whether the sequence copies runs in bulk, as RingBuffer does.
+  template <typename S, typename = void>
+  struct has_bulk_ops : std::false_type {};
+  template <typename S>
+  struct has_bulk_ops<
+      S, std::void_t<decltype(std::declval<S&>().append(
+                         std::declval<const value_type*>(), size_type{})),
+                     decltype(std::declval<S&>().pop_front_many(
+                         std::declval<value_type*>(), size_type{}))>>
+      : std::true_type {};
+
+  // Whether the sequence can set nodes aside, as List does with its pool.
+  template <typename S, typename = void>
+  struct has_node_pool : std::false_type {};
+  template <typename S>
+  struct has_node_pool<S, std::void_t<decltype(std::declval<S&>().reserve_nodes(
+                              size_type{}))>> : std::true_type {};
+
+  template <typename S, typename = void>
+  struct has_reserve : std::false_type {};
+  template <typename S>
+  struct has_reserve<
+      S, std::void_t<decltype(std::declval<S&>().reserve(size_type{}))>>
+      : std::true_type {};
+
+ public:
   queue() = default;
   queue(std::initializer_list<value_type> const& items) {
     for (auto& el : items) {
@@ -20,6 +56,13 @@ class queue {
   }
   queue(const queue& q) : c(q.c) {}
   queue(queue&& q) noexcept : c(std::move(q.c)) {}
+
+  template <typename Alloc, typename = uses_alloc_t<Alloc>>
+  explicit queue(const Alloc& alloc) : c(alloc) {}
+  template <typename Alloc, typename = uses_alloc_t<Alloc>>
+  queue(const queue& q, const Alloc& alloc) : c(q.c, alloc) {}
+  template <typename Alloc, typename = uses_alloc_t<Alloc>>
+  queue(queue&& q, const Alloc& alloc) : c(std::move(q.c), alloc) {}
   ~queue() = default;
 
   queue& operator=(const queue& q) {
@@ -47,8 +90,71 @@ class queue {
   void pop() { c.pop_front(); }
   void swap(queue& other) { c.swap(other.c); }
 
+  // Prepares room for depth elements, so that a queue cycling at that depth
+  // stops allocating. A no-op for sequences that cannot set memory aside.
+  void reserve(size_type depth);
+
+  // Bulk variants of push and pop. Sequences with append and pop_front_many
+  // move the whole run at once; others fall back to one element at a time.
+  void push_many(Span<const value_type> items);
+  size_type pop_many(value_type* out, size_type count);
+
  private:
   sequence_ c;
 };
 
+template <typename T, typename S>
+void queue<T, S>::push_many(Span<const value_type> items) {
+  if constexpr (has_bulk_ops<S>::value) {
+    c.append(items.data(), items.size());
+  } else {
+    for (size_type i = 0; i < items.size(); ++i) {
+      c.push_back(items.data()[i]);
+    }
+  }
+}
+
+template <typename T, typename S>
+void queue<T, S>::reserve(size_type depth) {
+  if constexpr (has_node_pool<S>::value) {
+    if (depth > c.size()) {
+      c.reserve_nodes(depth - c.size());
+    }
+  } else if constexpr (has_reserve<S>::value) {
+    c.reserve(depth);
+  }
+}
+
+// Pops up to count elements into out, oldest first, and returns how many
+// were popped.
+template <typename T, typename S>
+typename queue<T, S>::size_type queue<T, S>::pop_many(value_type* out,
+                                                      size_type count) {
+  if constexpr (has_bulk_ops<S>::value) {
+    return c.pop_front_many(out, count);
+  } else {
+    size_type popped = 0;
+    for (; popped < count && !c.empty(); ++popped) {
+      out[popped] = c.front();
+      c.pop_front();
+    }
+    return popped;
+  }
+}
+
+namespace pmr {
+
+template <typename T>
+using queue = s21::queue<T, s21::pmr::List<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
+
+namespace std {
+
+template <typename T, typename Sequence, typename Alloc>
+struct uses_allocator<s21::queue<T, Sequence>, Alloc>
+    : uses_allocator<Sequence, Alloc>::type {};
+
+}  // namespace std
@@ -0,0 +1,506 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_ring_buffer_iterator.h"
+
+namespace s21 {
+
+// Growable circular buffer: a power-of-two array in which the live elements
+// run from head_ for size_ slots and wrap around the end. Pushing and
+// popping at either end is O(1) and does not allocate once the capacity
+// has been reached, which makes it a good queue backing for steady-state
+// traffic. Growth relocates the elements and invalidates references.
+//
+// append and pop_front_many move whole runs in at most two contiguous
+// segments, with memcpy for trivially copyable T.
+template <typename T, typename Allocator = std::allocator<T>>
+class RingBuffer {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T*>,
+                "RingBuffer requires an allocator with raw pointers");
+
+  static constexpr size_t kMinCapacity = 8;
+  static constexpr bool kMemcpy = std::is_trivially_copyable_v<T>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = RingBufferIterator<T>;
+  using const_iterator = RingBufferIterator<const T>;
+  using size_type = size_t;
+
+  RingBuffer() : RingBuffer(Allocator()) {}
+  explicit RingBuffer(const Allocator& alloc) noexcept : alloc_(alloc) {}
+  explicit RingBuffer(size_type count, const_reference value = value_type{},
+                      const Allocator& alloc = Allocator());
+  RingBuffer(std::initializer_list<value_type> const& items,
+             const Allocator& alloc = Allocator());
+  RingBuffer(const RingBuffer& other);
+  RingBuffer(const RingBuffer& other, const Allocator& alloc);
+  RingBuffer(RingBuffer&& other) noexcept;
+  RingBuffer(RingBuffer&& other, const Allocator& alloc);
+  ~RingBuffer();
+
+  RingBuffer& operator=(const RingBuffer& other);
+  RingBuffer& operator=(RingBuffer&& other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value);
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) { return at(pos); }
+  const_reference operator[](size_type pos) const { return at(pos); }
+  reference front() { return at(0); }
+  const_reference front() const { return at(0); }
+  reference back() { return at(size_ - 1); }
+  const_reference back() const { return at(size_ - 1); }
+
+  iterator begin() noexcept { return iterator(data_, mask(), head_, 0); }
+  iterator end() noexcept { return iterator(data_, mask(), head_, size_); }
+  const_iterator begin() const noexcept {
+    return const_iterator(data_, mask(), head_, 0);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(data_, mask(), head_, size_);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+  size_type capacity() const noexcept { return capacity_; }
+  void reserve(size_type new_cap);
+
+  void clear() noexcept;
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(T&& value) { emplace_front(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+  template <typename... Args>
+  void insert_many_front(Args&&... args);
+  void append(const_pointer first, size_type count);
+  void pop_back();
+  void pop_front();
+  size_type pop_front_many(pointer out, size_type count);
+  void swap(RingBuffer& other) noexcept;
+
+ private:
+  size_type mask() const noexcept { return capacity_ ? capacity_ - 1 : 0; }
+  pointer slot(size_type pos) const noexcept {
+    return data_ + ((head_ + pos) & mask());
+  }
+  size_type grown_capacity(size_type count) const;
+  void reallocate(size_type new_cap);
+  void release() noexcept;
+  void steal(RingBuffer& other) noexcept;
+  void move_elements(RingBuffer& other);
+
+  pointer data_{nullptr};
+  size_type capacity_{0};
+  size_type head_{0};
+  size_type size_{0};
+  Allocator alloc_;
+};
+
+template <typename T, typename A>
+RingBuffer<T, A>::RingBuffer(size_type count, const_reference value,
+                             const A& alloc)
+    : alloc_(alloc) {
+  try {
+    reserve(count);
+    while (count--) {
+      push_back(value);
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+RingBuffer<T, A>::RingBuffer(std::initializer_list<value_type> const& items,
+                             const A& alloc)
+    : alloc_(alloc) {
+  try {
+    append(items.begin(), items.size());
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+RingBuffer<T, A>::RingBuffer(const RingBuffer& other)
+    : RingBuffer(other, alloc_traits::select_on_container_copy_construction(
+                            other.alloc_)) {}
+
+template <typename T, typename A>
+RingBuffer<T, A>::RingBuffer(const RingBuffer& other, const A& alloc)
+    : alloc_(alloc) {
+  try {
+    reserve(other.size_);
+    for (auto& el : other) {
+      push_back(el);
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+RingBuffer<T, A>::RingBuffer(RingBuffer&& other) noexcept
+    : alloc_(std::move(other.alloc_)) {
+  steal(other);
+}
+
+template <typename T, typename A>
+RingBuffer<T, A>::RingBuffer(RingBuffer&& other, const A& alloc)
+    : alloc_(alloc) {
+  if (alloc_ == other.alloc_) {
+    steal(other);
+    return;
+  }
+  try {
+    move_elements(other);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+RingBuffer<T, A>::~RingBuffer() {
+  release();
+}
+
+template <typename T, typename A>
+RingBuffer<T, A>& RingBuffer<T, A>::operator=(const RingBuffer& other) {
+  if (this == &other) {
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+    if (alloc_ != other.alloc_) {
+      release();
+    }
+    alloc_ = other.alloc_;
+  }
+  clear();
+  reserve(other.size_);
+  for (auto& el : other) {
+    push_back(el);
+  }
+
+  return *this;
+}
+
+template <typename T, typename A>
+RingBuffer<T, A>& RingBuffer<T, A>::operator=(RingBuffer&& other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
+  if (this == &other) {
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    release();
+    alloc_ = std::move(other.alloc_);
+    steal(other);
+  } else if (alloc_ == other.alloc_) {
+    release();
+    steal(other);
+  } else {
+    move_elements(other);
+  }
+
+  return *this;
+}
+
+template <typename T, typename A>
+typename RingBuffer<T, A>::reference RingBuffer<T, A>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the buffer");
+  }
+  return *slot(pos);
+}
+
+template <typename T, typename A>
+typename RingBuffer<T, A>::const_reference RingBuffer<T, A>::at(
+    size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the buffer");
+  }
+  return *slot(pos);
+}
+
+// The largest power of two the allocator can provide.
+template <typename T, typename A>
+typename RingBuffer<T, A>::size_type RingBuffer<T, A>::max_size()
+    const noexcept {
+  size_type limit = alloc_traits::max_size(alloc_);
+  size_type size = 1;
+  while (size <= limit / 2) {
+    size *= 2;
+  }
+  return size;
+}
+
+template <typename T, typename A>
+void RingBuffer<T, A>::reserve(size_type new_cap) {
+  if (new_cap > capacity_) {
+    reallocate(grown_capacity(new_cap - size_));
+  }
+}
+
+template <typename T, typename A>
+void RingBuffer<T, A>::clear() noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_type i = 0; i < size_; ++i) {
+      alloc_traits::destroy(alloc_, slot(i));
+    }
+  }
+  head_ = size_ = 0;
+}
+
+// The element is built before growing, since args may refer to an element
+// about to be relocated.
+template <typename T, typename A>
+template <typename... Args>
+typename RingBuffer<T, A>::reference RingBuffer<T, A>::emplace_back(
+    Args&&... args) {
+  if (size_ == capacity_) {
+    T tmp(std::forward<Args>(args)...);
+    reallocate(grown_capacity(1));
+    alloc_traits::construct(alloc_, slot(size_), std::move(tmp));
+  } else {
+    alloc_traits::construct(alloc_, slot(size_), std::forward<Args>(args)...);
+  }
+  return *slot(size_++);
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename RingBuffer<T, A>::reference RingBuffer<T, A>::emplace_front(
+    Args&&... args) {
+  if (size_ == capacity_) {
+    T tmp(std::forward<Args>(args)...);
+    reallocate(grown_capacity(1));
+    alloc_traits::construct(alloc_, slot(capacity_ - 1), std::move(tmp));
+  } else {
+    alloc_traits::construct(alloc_, slot(capacity_ - 1),
+                            std::forward<Args>(args)...);
+  }
+  head_ = (head_ - 1) & mask();
+  ++size_;
+  return *slot(0);
+}
+
+template <typename T, typename A>
+template <typename... Args>
+void RingBuffer<T, A>::insert_many_back(Args&&... args) {
+  reserve(size_ + sizeof...(args));
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+// Each argument is pushed to the front in turn, so the last one ends up
+// first.
+template <typename T, typename A>
+template <typename... Args>
+void RingBuffer<T, A>::insert_many_front(Args&&... args) {
+  reserve(size_ + sizeof...(args));
+  (emplace_front(std::forward<Args>(args)), ...);
+}
+
+// Copies count elements from first to the back, growing at most once. first
+// must not point into this buffer.
+template <typename T, typename A>
+void RingBuffer<T, A>::append(const_pointer first, size_type count) {
+  if (count > capacity_ - size_) {
+    reallocate(grown_capacity(count));
+  }
+  if constexpr (kMemcpy) {
+    if (!count) {
+      return;
+    }
+    size_type tail = (head_ + size_) & mask();
+    size_type run = std::min(count, capacity_ - tail);
+    std::memcpy(data_ + tail, first, run * sizeof(T));
+    std::memcpy(data_, first + run, (count - run) * sizeof(T));
+    size_ += count;
+  } else {
+    for (; count; --count, ++first) {
+      alloc_traits::construct(alloc_, slot(size_), *first);
+      ++size_;
+    }
+  }
+}
+
+template <typename T, typename A>
+void RingBuffer<T, A>::pop_back() {
+  if (size_) {
+    alloc_traits::destroy(alloc_, slot(--size_));
+  }
+}
+
+template <typename T, typename A>
+void RingBuffer<T, A>::pop_front() {
+  if (size_) {
+    alloc_traits::destroy(alloc_, slot(0));
+    head_ = (head_ + 1) & mask();
+    --size_;
+  }
+}
+
+// Moves up to count elements from the front into out and returns how many
+// were taken. out must have room for them and must not alias the buffer.
+template <typename T, typename A>
+typename RingBuffer<T, A>::size_type RingBuffer<T, A>::pop_front_many(
+    pointer out, size_type count) {
+  count = std::min(count, size_);
+  if constexpr (kMemcpy) {
+    if (!count) {
+      return 0;
+    }
+    size_type run = std::min(count, capacity_ - head_);
+    std::memcpy(out, data_ + head_, run * sizeof(T));
+    std::memcpy(out + run, data_, (count - run) * sizeof(T));
+    head_ = (head_ + count) & mask();
+    size_ -= count;
+  } else {
+    for (size_type i = 0; i < count; ++i) {
+      out[i] = std::move(*slot(0));
+      pop_front();
+    }
+  }
+  return count;
+}
+
+template <typename T, typename A>
+void RingBuffer<T, A>::swap(RingBuffer& other) noexcept {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+}
+
+// Smallest power of two that fits count more elements, and at least double
+// the current capacity.
+template <typename T, typename A>
+typename RingBuffer<T, A>::size_type RingBuffer<T, A>::grown_capacity(
+    size_type count) const {
+  if (count > max_size() - size_) {
+    throw std::length_error("Error: Requested size exceeds max_size");
+  }
+  size_type new_cap = std::max(capacity_ * 2, kMinCapacity);
+  while (new_cap < size_ + count) {
+    new_cap *= 2;
+  }
+  return new_cap;
+}
+
+// Moves the elements to the start of a new buffer of new_cap slots. On a
+// throwing move the buffer is left untouched.
+template <typename T, typename A>
+void RingBuffer<T, A>::reallocate(size_type new_cap) {
+  pointer tmp;
+  try {
+    tmp = alloc_traits::allocate(alloc_, new_cap);
+  } catch (std::bad_alloc& e) {
+    throw std::runtime_error("Error: Failed to allocate memory");
+  }
+  if constexpr (kMemcpy) {
+    if (size_) {
+      size_type run = std::min(size_, capacity_ - head_);
+      std::memcpy(tmp, data_ + head_, run * sizeof(T));
+      std::memcpy(tmp + run, data_, (size_ - run) * sizeof(T));
+    }
+  } else {
+    size_type moved = 0;
+    try {
+      for (; moved < size_; ++moved) {
+        alloc_traits::construct(alloc_, tmp + moved,
+                                std::move_if_noexcept(*slot(moved)));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < moved; ++i) {
+        alloc_traits::destroy(alloc_, tmp + i);
+      }
+      alloc_traits::deallocate(alloc_, tmp, new_cap);
+      throw;
+    }
+  }
+  size_type size = size_;
+  clear();
+  if (data_) {
+    alloc_traits::deallocate(alloc_, data_, capacity_);
+  }
+  data_ = tmp;
+  capacity_ = new_cap;
+  size_ = size;
+}
+
+template <typename T, typename A>
+void RingBuffer<T, A>::release() noexcept {
+  clear();
+  if (data_) {
+    alloc_traits::deallocate(alloc_, data_, capacity_);
+  }
+  data_ = nullptr;
+  capacity_ = 0;
+}
+
+template <typename T, typename A>
+void RingBuffer<T, A>::steal(RingBuffer& other) noexcept {
+  data_ = other.data_;
+  capacity_ = other.capacity_;
+  head_ = other.head_;
+  size_ = other.size_;
+  other.data_ = nullptr;
+  other.capacity_ = other.head_ = other.size_ = 0;
+}
+
+// Fallback of the moves when other's buffer belongs to an unequal allocator.
+template <typename T, typename A>
+void RingBuffer<T, A>::move_elements(RingBuffer& other) {
+  clear();
+  reserve(other.size_);
+  for (auto& el : other) {
+    emplace_back(std::move(el));
+  }
+  other.clear();
+}
+
+namespace pmr {
+
+template <typename T>
+using RingBuffer = s21::RingBuffer<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
+}  // namespace s21
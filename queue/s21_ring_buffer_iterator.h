@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace s21 {
+
+// Random-access iterator over a RingBuffer. It stores the logical index from
+// the head, and wraps it into the power-of-two buffer only when
+// dereferenced. T is const-qualified for const iterators.
+template <typename T>
+class RingBufferIterator {
+  using slot_pointer = std::remove_const_t<T>*;
+
+ public:
+  using value_type = std::remove_const_t<T>;
+  using pointer = T*;
+  using reference = T&;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+
+  RingBufferIterator() = default;
+  RingBufferIterator(slot_pointer data, size_t mask, size_t head,
+                     size_t index) noexcept
+      : data_(data), mask_(mask), head_(head), index_(index) {}
+  template <typename U, typename = std::enable_if_t<
+                            std::is_same_v<const U, T> &&
+                            !std::is_same_v<U, T>>>
+  RingBufferIterator(const RingBufferIterator<U>& other) noexcept
+      : data_(other.data_),
+        mask_(other.mask_),
+        head_(other.head_),
+        index_(other.index_) {}
+
+  reference operator*() const noexcept {
+    return data_[(head_ + index_) & mask_];
+  }
+  pointer operator->() const noexcept { return &**this; }
+  reference operator[](difference_type n) const noexcept {
+    return *(*this + n);
+  }
+
+  RingBufferIterator& operator++() noexcept;
+  RingBufferIterator operator++(int) noexcept;
+  RingBufferIterator& operator--() noexcept;
+  RingBufferIterator operator--(int) noexcept;
+  RingBufferIterator& operator+=(difference_type n) noexcept;
+  RingBufferIterator& operator-=(difference_type n) noexcept;
+  RingBufferIterator operator+(difference_type n) const noexcept;
+  RingBufferIterator operator-(difference_type n) const noexcept;
+  difference_type operator-(const RingBufferIterator& other) const noexcept;
+
+  bool operator==(const RingBufferIterator& other) const noexcept {
+    return index_ == other.index_;
+  }
+  bool operator!=(const RingBufferIterator& other) const noexcept {
+    return index_ != other.index_;
+  }
+  bool operator<(const RingBufferIterator& other) const noexcept {
+    return index_ < other.index_;
+  }
+  bool operator>(const RingBufferIterator& other) const noexcept {
+    return index_ > other.index_;
+  }
+  bool operator<=(const RingBufferIterator& other) const noexcept {
+    return index_ <= other.index_;
+  }
+  bool operator>=(const RingBufferIterator& other) const noexcept {
+    return index_ >= other.index_;
+  }
+
+ private:
+  template <typename>
+  friend class RingBufferIterator;
+
+  slot_pointer data_{nullptr};
+  size_t mask_{0};
+  size_t head_{0};
+  size_t index_{0};
+};
+
+template <typename T>
+RingBufferIterator<T>& RingBufferIterator<T>::operator++() noexcept {
+  ++index_;
+  return *this;
+}
+
+template <typename T>
+RingBufferIterator<T> RingBufferIterator<T>::operator++(int) noexcept {
+  auto tmp{*this};
+  ++index_;
+  return tmp;
+}
+
+template <typename T>
+RingBufferIterator<T>& RingBufferIterator<T>::operator--() noexcept {
+  --index_;
+  return *this;
+}
+
+template <typename T>
+RingBufferIterator<T> RingBufferIterator<T>::operator--(int) noexcept {
+  auto tmp{*this};
+  --index_;
+  return tmp;
+}
+
+template <typename T>
+RingBufferIterator<T>& RingBufferIterator<T>::operator+=(
+    difference_type n) noexcept {
+  index_ += n;
+  return *this;
+}
+
+template <typename T>
+RingBufferIterator<T>& RingBufferIterator<T>::operator-=(
+    difference_type n) noexcept {
+  index_ -= n;
+  return *this;
+}
+
+template <typename T>
+RingBufferIterator<T> RingBufferIterator<T>::operator+(
+    difference_type n) const noexcept {
+  auto tmp{*this};
+  return tmp += n;
+}
+
+template <typename T>
+RingBufferIterator<T> RingBufferIterator<T>::operator-(
+    difference_type n) const noexcept {
+  auto tmp{*this};
+  return tmp -= n;
+}
+
+template <typename T>
+typename RingBufferIterator<T>::difference_type
+RingBufferIterator<T>::operator-(
+    const RingBufferIterator& other) const noexcept {
+  return static_cast<difference_type>(index_ - other.index_);
+}
+
+template <typename T>
+RingBufferIterator<T> operator+(
+    typename RingBufferIterator<T>::difference_type n,
+    const RingBufferIterator<T>& it) noexcept {
+  return it + n;
+}
+
+}  // namespace s21
@@ -1,10 +1,21 @@
 #pragma once
 
 #include "./list/s21_list.h"
+#include "./list/s21_unrolled_list.h"
+#include "./list/s21_intrusive_list.h"
 #include "./vector/s21_vector.h"
+#include "./vector/s21_small_vector.h"
+#include "./vector/s21_static_vector.h"
+#include "./vector/s21_aligned_vector.h"
+#include "./vector/s21_mmap_vector.h"
+#include "./deque/s21_deque.h"
 #include "./stack/s21_stack.h"
 #include "./queue/s21_queue.h"
+#include "./queue/s21_ring_buffer.h"
 #include "./map/s21_map.h"
 #include "./set/s21_set.h"
 #include "./array/s21_array.h"
+#include "./span/s21_span.h"
 #include "./multiset/s21_multiset.h"
+#include "./memory/s21_memory_resource.h"
+#include "./simd/s21_simd.h"
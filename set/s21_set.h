@@ -2,32 +2,42 @@
 
 namespace s21 {
 
-template <typename K, typename H = std::hash<K>>
+template <typename K, typename H = std::hash<K>,
+          typename Allocator = std::allocator<K>>
 class Set {
  public:
-  using table = hash_table<K, K, H>;
+  using table = hash_table<K, K, H, Allocator>;
   using key_type = K;
   using mapped_type = K;
   using value_type = std::pair<key_type, mapped_type>;
+  using allocator_type = typename table::allocator_type;
   using reference = value_type&;
   using iterator = typename table::iterator;
   using size_type = size_t;
 
   Set() = default;
+  explicit Set(const allocator_type& alloc) : t(alloc) {}
 
-  Set(std::initializer_list<mapped_type> const& items) {
+  Set(std::initializer_list<mapped_type> const& items,
+      const allocator_type& alloc = allocator_type())
+      : t(alloc) {
     for (auto& it : items) {
       t[it] = it;
     }
   }
 
   Set(const Set& other) = default;
+  Set(const Set& other, const allocator_type& alloc) : t(other.t, alloc) {}
   Set(Set&& other) = default;
+  Set(Set&& other, const allocator_type& alloc)
+      : t(std::move(other.t), alloc) {}
   ~Set() noexcept = default;
 
   Set& operator=(const Set& other) = default;
   Set& operator=(Set&& other) noexcept = default;
 
+  allocator_type get_allocator() const noexcept { return t.get_allocator(); }
+
   iterator begin() { return t.begin(); }
   iterator end() { return t.end(); }
 
@@ -53,4 +63,11 @@ class Set {
   table t;
 };
 
+namespace pmr {
+
+template <typename K, typename H = std::hash<K>>
+using Set = s21::Set<K, H, std::pmr::polymorphic_allocator<K>>;
+
+}  // namespace pmr
+
 }  // namespace s21
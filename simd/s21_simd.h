@@ -0,0 +1,491 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define S21_SIMD_X86 1
+#else
+#define S21_SIMD_X86 0
+#endif
+
+#if defined(__GNUC__)
+#define S21_SIMD_INLINE inline __attribute__((always_inline))
+#else
+#define S21_SIMD_INLINE inline
+#endif
+
+namespace s21 {
+namespace simd {
+
+// Scans and reductions over contiguous arithmetic data. Each operation has a
+// scalar, an SSE2 and an AVX2 version; the widest one the CPU supports is
+// picked at run time. Element types other than integers, float and double
+// always take the scalar path.
+//
+// Every operation comes as a (pointer, size) overload and as an overload
+// for any container with data() and size(), such as Vector, Array,
+// StaticVector or a span. Positions are returned as indices, with size
+// meaning "not found" as with std::find.
+//
+// accumulate adds floating point values in a different order than a plain
+// loop, so the result may differ in the last bits.
+enum class Isa { kScalar, kSse2, kAvx2 };
+
+Isa detected_isa() noexcept;
+Isa active_isa() noexcept;
+void set_isa(Isa isa) noexcept;
+
+namespace internal {
+
+template <typename T>
+inline constexpr bool is_vectorizable_v =
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+inline Isa& isa_setting() noexcept {
+  static Isa isa = detected_isa();
+  return isa;
+}
+
+// GCC drops vector_size on a dependent alias template, a member typedef
+// keeps it.
+template <typename T, size_t Bytes>
+struct vec {
+  typedef T type __attribute__((vector_size(Bytes)));
+};
+template <typename T, size_t Bytes>
+using vec_t = typename vec<T, Bytes>::type;
+
+// Vectors are passed by reference: 32-byte vectors by value would get a
+// different ABI inside and outside of AVX2 code.
+template <typename V>
+S21_SIMD_INLINE void load(V& v, const void* p) {
+  std::memcpy(&v, p, sizeof(V));
+}
+
+template <typename V, typename T>
+S21_SIMD_INLINE void broadcast(V& v, T value) {
+  for (size_t i = 0; i < sizeof(V) / sizeof(T); ++i) {
+    v[i] = value;
+  }
+}
+
+template <typename M>
+S21_SIMD_INLINE bool any_lane(const M& mask) {
+  uint64_t words[sizeof(M) / sizeof(uint64_t)];
+  std::memcpy(words, &mask, sizeof(M));
+  uint64_t acc = 0;
+  for (uint64_t word : words) {
+    acc |= word;
+  }
+  return acc != 0;
+}
+
+// Kernels, written once over GCC vector types of Bytes width and
+// instantiated for SSE2 (16) and AVX2 (32) below.
+
+template <size_t Bytes, typename T>
+S21_SIMD_INLINE size_t find_kernel(const T* data, size_t size, T value) {
+  using V = vec_t<T, Bytes>;
+  constexpr size_t kLanes = Bytes / sizeof(T);
+  V needle;
+  broadcast(needle, value);
+  size_t i = 0;
+  for (; i + kLanes <= size; i += kLanes) {
+    V chunk;
+    load(chunk, data + i);
+    if (any_lane(chunk == needle)) {
+      break;
+    }
+  }
+  for (; i < size; ++i) {
+    if (data[i] == value) {
+      return i;
+    }
+  }
+  return size;
+}
+
+template <size_t Bytes, typename T>
+S21_SIMD_INLINE size_t count_kernel(const T* data, size_t size, T value) {
+  using V = vec_t<T, Bytes>;
+  using M = decltype(V{} == V{});
+  constexpr size_t kLanes = Bytes / sizeof(T);
+  // Lane counters are as wide as T, flush them before they can overflow.
+  constexpr size_t kBlock = sizeof(T) >= 4
+                                ? size_t(1) << 30
+                                : (size_t(1) << (8 * sizeof(T) - 1)) - 1;
+  V needle;
+  broadcast(needle, value);
+  size_t total = 0;
+  size_t i = 0;
+  while (i + kLanes <= size) {
+    M acc{};
+    for (size_t n = 0; n < kBlock && i + kLanes <= size; ++n, i += kLanes) {
+      V chunk;
+      load(chunk, data + i);
+      acc -= chunk == needle;
+    }
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      total += static_cast<size_t>(acc[lane]);
+    }
+  }
+  for (; i < size; ++i) {
+    total += data[i] == value;
+  }
+  return total;
+}
+
+// Position of the smallest (or, with kMax, largest) value: the value is
+// reduced lane-wise first, then its first occurrence is looked up.
+template <size_t Bytes, bool kMax, typename T>
+S21_SIMD_INLINE size_t extremum_kernel(const T* data, size_t size) {
+  using V = vec_t<T, Bytes>;
+  constexpr size_t kLanes = Bytes / sizeof(T);
+  T best = data[0];
+  size_t i = 0;
+  if (size >= kLanes) {
+    V acc;
+    load(acc, data);
+    for (i = kLanes; i + kLanes <= size; i += kLanes) {
+      V chunk;
+      load(chunk, data + i);
+      // A lane holding NaN would never compare again, so it is replaced.
+      acc = ((kMax ? acc < chunk : chunk < acc) | (acc != acc)) ? chunk : acc;
+    }
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      if (kMax ? best < acc[lane] : acc[lane] < best) {
+        best = acc[lane];
+      }
+    }
+  }
+  for (; i < size; ++i) {
+    if (kMax ? best < data[i] : data[i] < best) {
+      best = data[i];
+    }
+  }
+  return find_kernel<Bytes>(data, size, best);
+}
+
+template <size_t Bytes, typename T>
+S21_SIMD_INLINE T accumulate_kernel(const T* data, size_t size, T init) {
+  using V = vec_t<T, Bytes>;
+  constexpr size_t kLanes = Bytes / sizeof(T);
+  V acc{};
+  size_t i = 0;
+  for (; i + kLanes <= size; i += kLanes) {
+    V chunk;
+    load(chunk, data + i);
+    acc += chunk;
+  }
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    init += acc[lane];
+  }
+  for (; i < size; ++i) {
+    init += data[i];
+  }
+  return init;
+}
+
+template <size_t Bytes, typename T>
+S21_SIMD_INLINE void fill_kernel(T* data, size_t size, T value) {
+  using V = vec_t<T, Bytes>;
+  constexpr size_t kLanes = Bytes / sizeof(T);
+  V v;
+  broadcast(v, value);
+  size_t i = 0;
+  for (; i + kLanes <= size; i += kLanes) {
+    std::memcpy(data + i, &v, sizeof(V));
+  }
+  for (; i < size; ++i) {
+    data[i] = value;
+  }
+}
+
+template <size_t Bytes, typename T>
+S21_SIMD_INLINE bool equal_kernel(const T* lhs, const T* rhs, size_t size) {
+  using V = vec_t<T, Bytes>;
+  constexpr size_t kLanes = Bytes / sizeof(T);
+  size_t i = 0;
+  for (; i + kLanes <= size; i += kLanes) {
+    V a;
+    V b;
+    load(a, lhs + i);
+    load(b, rhs + i);
+    if (any_lane(a != b)) {
+      return false;
+    }
+  }
+  for (; i < size; ++i) {
+    if (!(lhs[i] == rhs[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+#if S21_SIMD_X86
+
+// SSE2 is part of x86-64, the target attribute only matters for 32-bit
+// builds.
+#define S21_SIMD_SSE2 __attribute__((target("sse2")))
+#define S21_SIMD_AVX2 __attribute__((target("avx2")))
+
+template <typename T>
+S21_SIMD_SSE2 size_t find_sse2(const T* data, size_t size, T value) {
+  return find_kernel<16>(data, size, value);
+}
+template <typename T>
+S21_SIMD_AVX2 size_t find_avx2(const T* data, size_t size, T value) {
+  return find_kernel<32>(data, size, value);
+}
+
+template <typename T>
+S21_SIMD_SSE2 size_t count_sse2(const T* data, size_t size, T value) {
+  return count_kernel<16>(data, size, value);
+}
+template <typename T>
+S21_SIMD_AVX2 size_t count_avx2(const T* data, size_t size, T value) {
+  return count_kernel<32>(data, size, value);
+}
+
+template <typename T>
+S21_SIMD_SSE2 size_t min_element_sse2(const T* data, size_t size) {
+  return extremum_kernel<16, false>(data, size);
+}
+template <typename T>
+S21_SIMD_AVX2 size_t min_element_avx2(const T* data, size_t size) {
+  return extremum_kernel<32, false>(data, size);
+}
+
+template <typename T>
+S21_SIMD_SSE2 size_t max_element_sse2(const T* data, size_t size) {
+  return extremum_kernel<16, true>(data, size);
+}
+template <typename T>
+S21_SIMD_AVX2 size_t max_element_avx2(const T* data, size_t size) {
+  return extremum_kernel<32, true>(data, size);
+}
+
+template <typename T>
+S21_SIMD_SSE2 T accumulate_sse2(const T* data, size_t size, T init) {
+  return accumulate_kernel<16>(data, size, init);
+}
+template <typename T>
+S21_SIMD_AVX2 T accumulate_avx2(const T* data, size_t size, T init) {
+  return accumulate_kernel<32>(data, size, init);
+}
+
+template <typename T>
+S21_SIMD_SSE2 void fill_sse2(T* data, size_t size, T value) {
+  fill_kernel<16>(data, size, value);
+}
+template <typename T>
+S21_SIMD_AVX2 void fill_avx2(T* data, size_t size, T value) {
+  fill_kernel<32>(data, size, value);
+}
+
+template <typename T>
+S21_SIMD_SSE2 bool equal_sse2(const T* lhs, const T* rhs, size_t size) {
+  return equal_kernel<16>(lhs, rhs, size);
+}
+template <typename T>
+S21_SIMD_AVX2 bool equal_avx2(const T* lhs, const T* rhs, size_t size) {
+  return equal_kernel<32>(lhs, rhs, size);
+}
+
+#undef S21_SIMD_SSE2
+#undef S21_SIMD_AVX2
+
+// Expands to a return of the widest available kernel for op. Falls through
+// when T is not vectorizable or the CPU has neither extension.
+#define S21_SIMD_DISPATCH(T, op, ...)                     \
+  if constexpr (internal::is_vectorizable_v<T>) {         \
+    switch (active_isa()) {                               \
+      case Isa::kAvx2:                                    \
+        return internal::op##_avx2<T>(__VA_ARGS__);       \
+      case Isa::kSse2:                                    \
+        return internal::op##_sse2<T>(__VA_ARGS__);       \
+      case Isa::kScalar:                                  \
+        break;                                            \
+    }                                                     \
+  }
+
+#else
+
+#define S21_SIMD_DISPATCH(T, op, ...)
+
+#endif  // S21_SIMD_X86
+
+}  // namespace internal
+
+inline Isa detected_isa() noexcept {
+#if S21_SIMD_X86
+  static const Isa isa = __builtin_cpu_supports("avx2")   ? Isa::kAvx2
+                         : __builtin_cpu_supports("sse2") ? Isa::kSse2
+                                                          : Isa::kScalar;
+  return isa;
+#else
+  return Isa::kScalar;
+#endif
+}
+
+inline Isa active_isa() noexcept { return internal::isa_setting(); }
+
+// Restricts the kernels to isa or below, for tests and benchmarks. Not
+// thread-safe; anything above detected_isa() is clamped.
+inline void set_isa(Isa isa) noexcept {
+  internal::isa_setting() = std::min(isa, detected_isa());
+}
+
+template <typename T>
+size_t find(const T* data, size_t size, T value) {
+  S21_SIMD_DISPATCH(T, find, data, size, value)
+  for (size_t i = 0; i < size; ++i) {
+    if (data[i] == value) {
+      return i;
+    }
+  }
+  return size;
+}
+
+template <typename T>
+size_t count(const T* data, size_t size, T value) {
+  S21_SIMD_DISPATCH(T, count, data, size, value)
+  size_t total = 0;
+  for (size_t i = 0; i < size; ++i) {
+    total += data[i] == value;
+  }
+  return total;
+}
+
+// A NaN in front makes every comparison false, which std::min_element
+// answers with 0; the vector kernels would look for the NaN and miss it.
+template <typename T>
+size_t min_element(const T* data, size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    if (std::isnan(data[0])) {
+      return 0;
+    }
+  }
+  S21_SIMD_DISPATCH(T, min_element, data, size)
+  T best = data[0];
+  size_t pos = 0;
+  for (size_t i = 1; i < size; ++i) {
+    if (data[i] < best) {
+      best = data[i];
+      pos = i;
+    }
+  }
+  return pos;
+}
+
+template <typename T>
+size_t max_element(const T* data, size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    if (std::isnan(data[0])) {
+      return 0;
+    }
+  }
+  S21_SIMD_DISPATCH(T, max_element, data, size)
+  T best = data[0];
+  size_t pos = 0;
+  for (size_t i = 1; i < size; ++i) {
+    if (best < data[i]) {
+      best = data[i];
+      pos = i;
+    }
+  }
+  return pos;
+}
+
+template <typename T>
+T accumulate(const T* data, size_t size, T init) {
+  S21_SIMD_DISPATCH(T, accumulate, data, size, init)
+  for (size_t i = 0; i < size; ++i) {
+    init += data[i];
+  }
+  return init;
+}
+
+template <typename T>
+void fill(T* data, size_t size, T value) {
+  S21_SIMD_DISPATCH(T, fill, data, size, value)
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = value;
+  }
+}
+
+template <typename T>
+bool equal(const T* lhs, const T* rhs, size_t size) {
+  S21_SIMD_DISPATCH(T, equal, lhs, rhs, size)
+  for (size_t i = 0; i < size; ++i) {
+    if (!(lhs[i] == rhs[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Same contract as std::memchr.
+inline const void* memchr(const void* data, int ch, size_t size) {
+  auto bytes = static_cast<const unsigned char*>(data);
+  size_t pos = find(bytes, size, static_cast<unsigned char>(ch));
+  return pos == size ? nullptr : bytes + pos;
+}
+
+// Container overloads.
+
+template <typename C>
+size_t find(const C& c, const typename C::value_type& value) {
+  return find(c.data(), c.size(), value);
+}
+
+template <typename C>
+size_t count(const C& c, const typename C::value_type& value) {
+  return count(c.data(), c.size(), value);
+}
+
+template <typename C>
+size_t min_element(const C& c) {
+  return min_element(c.data(), c.size());
+}
+
+template <typename C>
+size_t max_element(const C& c) {
+  return max_element(c.data(), c.size());
+}
+
+template <typename C>
+typename C::value_type accumulate(const C& c,
+                                  typename C::value_type init = {}) {
+  return accumulate(c.data(), c.size(), init);
+}
+
+// Takes C&& so that a temporary view such as a Span slice can be filled.
+template <typename C>
+void fill(C&& c,
+          const typename std::remove_reference_t<C>::value_type& value) {
+  fill(c.data(), c.size(), value);
+}
+
+template <typename C1, typename C2>
+bool equal(const C1& lhs, const C2& rhs) {
+  return lhs.size() == rhs.size() && equal(lhs.data(), rhs.data(), lhs.size());
+}
+
+#undef S21_SIMD_DISPATCH
+
+}  // namespace simd
+}  // namespace s21
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector_iterator.h"
+
+namespace s21 {
+
+// Non-owning view of a contiguous run of T. A Span can be made from any
+// container with data() and size() (Vector, SmallVector, StaticVector,
+// Array, another Span) or from a pointer and a length; Span<const T> is the
+// read-only flavour. Slicing with first, last and subspan never copies, and
+// the view is invalidated by whatever invalidates the container's
+// iterators.
+template <typename T>
+class Span {
+  template <typename C>
+  using container_data_t = decltype(std::declval<C&>().data());
+  template <typename C>
+  using if_compatible = std::enable_if_t<
+      !std::is_same_v<std::remove_cv_t<C>, Span> &&
+      std::is_convertible_v<container_data_t<C>, T*> &&
+      std::is_same_v<std::remove_cv_t<std::remove_pointer_t<
+                         container_data_t<C>>>,
+                     std::remove_cv_t<T>>>;
+
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using size_type = size_t;
+  using iterator = VectorIterator<T>;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  constexpr Span() noexcept = default;
+  constexpr Span(pointer data, size_type size) noexcept
+      : data_(data), size_(size) {}
+  template <typename C, typename = if_compatible<C>>
+  constexpr Span(C& container) noexcept
+      : data_(container.data()), size_(container.size()) {}
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U*, T*> &&
+                            !std::is_same_v<U, T>>>
+  constexpr Span(const Span<U>& other) noexcept
+      : data_(other.data()), size_(other.size()) {}
+
+  constexpr reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos) const { return at(pos); }
+  constexpr reference front() const { return at(0); }
+  constexpr reference back() const { return at(size_ - 1); }
+  constexpr pointer data() const noexcept { return data_; }
+
+  iterator begin() const { return iterator(data_, size_); }
+  iterator end() const { return begin() + size_; }
+
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr size_type size_bytes() const noexcept { return size_ * sizeof(T); }
+
+  constexpr Span first(size_type count) const;
+  constexpr Span last(size_type count) const;
+  constexpr Span subspan(size_type offset, size_type count = npos) const;
+
+ private:
+  pointer data_{nullptr};
+  size_type size_{0};
+};
+
+template <typename T>
+constexpr typename Span<T>::reference Span<T>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the span");
+  }
+  return data_[pos];
+}
+
+template <typename T>
+constexpr Span<T> Span<T>::first(size_type count) const {
+  if (count > size_) {
+    throw std::out_of_range("Error: Span slice goes beyond the span");
+  }
+  return Span(data_, count);
+}
+
+template <typename T>
+constexpr Span<T> Span<T>::last(size_type count) const {
+  if (count > size_) {
+    throw std::out_of_range("Error: Span slice goes beyond the span");
+  }
+  return Span(data_ + size_ - count, count);
+}
+
+// count == npos takes everything from offset to the end.
+template <typename T>
+constexpr Span<T> Span<T>::subspan(size_type offset, size_type count) const {
+  if (offset > size_ || (count != npos && count > size_ - offset)) {
+    throw std::out_of_range("Error: Span slice goes beyond the span");
+  }
+  return Span(data_ + offset, count == npos ? size_ - offset : count);
+}
+
+}  // namespace s21
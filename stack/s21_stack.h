@@ -10,6 +10,12 @@ class stack {
   using const_reference = typename sequence_::const_reference;
   using size_type = typename sequence_::size_type;
 
+ private:
+  template <typename Alloc>
+  using uses_alloc_t =
+      std::enable_if_t<std::uses_allocator<sequence_, Alloc>::value>;
+
+ public:
   stack() = default;
   stack(std::initializer_list<value_type> const& items) {
     for (auto& el : items) {
@@ -18,6 +24,13 @@ class stack {
   }
   stack(const stack& s) : c(s.c) {}
   stack(stack&& s) noexcept : c(std::move(s.c)) {}
+
+  template <typename Alloc, typename = uses_alloc_t<Alloc>>
+  explicit stack(const Alloc& alloc) : c(alloc) {}
+  template <typename Alloc, typename = uses_alloc_t<Alloc>>
+  stack(const stack& s, const Alloc& alloc) : c(s.c, alloc) {}
+  template <typename Alloc, typename = uses_alloc_t<Alloc>>
+  stack(stack&& s, const Alloc& alloc) : c(std::move(s.c), alloc) {}
   ~stack() = default;
 
   stack& operator=(const stack& s) {
@@ -48,4 +61,19 @@ class stack {
   sequence_ c;
 };
 
+namespace pmr {
+
+template <typename T>
+using stack = s21::stack<T, s21::pmr::List<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
+
+namespace std {
+
+template <typename T, typename Sequence, typename Alloc>
+struct uses_allocator<s21::stack<T, Sequence>, Alloc>
+    : uses_allocator<Sequence, Alloc>::type {};
+
+}  // namespace std
@@ -1,10 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <deque>
+#include <fstream>
 #include <list>
 #include <map>
+#include <memory_resource>
+#include <numeric>
 #include <queue>
 #include <set>
+#include <sstream>
 #include <stack>
+#include <thread>
 #include <vector>
 #include <array>
 
@@ -40,14 +47,16 @@ TEST(ArrayTest, CopyConstructor) {
 }
 
 TEST(ArrayTest, MoveConstructor) {
-  s21::Array<int, 3> arr1 = {1, 2, 3};
-  s21::Array<int, 3> arr2(std::move(arr1));
-  EXPECT_TRUE(arr1.empty());
-  EXPECT_EQ(0, arr1.size());
+  s21::Array<std::string, 3> arr1 = {"a", "b", "c"};
+  s21::Array<std::string, 3> arr2(std::move(arr1));
+  EXPECT_EQ(3, arr1.size());
   EXPECT_EQ(3, arr2.size());
+  EXPECT_EQ("c", arr2[2]);
 }
 
-TEST(ArrayTest, Destructor) { s21::Array<int, 3> arr = {1, 2, 3}; }
+TEST(ArrayTest, Destructor) {
+  s21::Array<std::string, 3> arr = {"a", "b", "c"};
+}
 
 TEST(ArrayTest, AssignmentOperatorMove) {
   s21::Array<int, 3> arr1 = {1, 2, 3};
@@ -98,6 +107,35 @@ TEST(ArrayTest, Swap) {
   EXPECT_EQ(1, arr2[0]);
   EXPECT_EQ(2, arr2[1]);
 }
+
+TEST(ArrayTest, Aggregate) {
+  constexpr s21::Array<int, 3> arr = {1, 2, 3};
+  static_assert(arr[1] == 2);
+  static_assert(arr.back() == 3);
+  static_assert(arr.size() == 3);
+  static_assert(sizeof(arr) == 3 * sizeof(int));
+  static_assert(std::is_trivially_copyable_v<s21::Array<int, 3>>);
+  EXPECT_EQ(arr.data()[2], 3);
+  EXPECT_THROW(arr.at(3), std::out_of_range);
+}
+
+TEST(ArrayTest, Comparison) {
+  constexpr s21::Array<int, 3> a = {1, 2, 3};
+  constexpr s21::Array<int, 3> b = {1, 2, 4};
+  static_assert(a == a);
+  static_assert(a != b);
+  static_assert(a < b);
+  static_assert(b > a);
+  static_assert(a <= a && a >= a);
+}
+
+TEST(ArrayTest, Empty) {
+  s21::Array<int, 0> arr{};
+  EXPECT_TRUE(arr.empty());
+  EXPECT_EQ(0, arr.size());
+  EXPECT_TRUE(arr.begin() == arr.end());
+  EXPECT_THROW(arr.at(0), std::out_of_range);
+}
 // Multiset
 
 TEST(MultisetTest, DefaultConstructor) {
@@ -561,6 +599,54 @@ TEST(VectorTest, Modifiers_erase_5) {
   }
 }
 
+TEST(VectorTest, Modifiers_erase_range) {
+  s21::Vector<std::string> v{"a", "b", "c", "d", "e"};
+  auto it = v.erase(v.begin() + 1, v.begin() + 3);
+  EXPECT_EQ(*it, "d");
+  EXPECT_EQ(v.size(), 3U);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[1], "d");
+  EXPECT_EQ(v[2], "e");
+
+  v.erase(v.begin(), v.begin());
+  EXPECT_EQ(v.size(), 3U);
+  it = v.erase(v.begin() + 1, v.end());
+  EXPECT_EQ(it, v.end());
+  EXPECT_EQ(v.size(), 1U);
+}
+
+TEST(VectorTest, Modifiers_unstable_erase) {
+  s21::Vector<std::string> v{"a", "b", "c", "d"};
+  auto it = v.unstable_erase(v.begin() + 1);
+  EXPECT_EQ(*it, "d");
+  EXPECT_EQ(v.size(), 3U);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[2], "c");
+
+  it = v.unstable_erase(v.end() - 1);
+  EXPECT_EQ(it, v.end());
+  EXPECT_EQ(v.back(), "d");
+}
+
+TEST(VectorTest, Modifiers_erase_if) {
+  s21::Vector<std::shared_ptr<int>> v;
+  std::weak_ptr<int> removed;
+  for (int i = 0; i < 10; ++i) {
+    v.push_back(std::make_shared<int>(i));
+  }
+  removed = v[3];
+  auto count = s21::erase_if(v, [](const auto& p) { return *p % 3 == 0; });
+  EXPECT_EQ(count, 4U);
+  EXPECT_EQ(v.size(), 6U);
+  EXPECT_TRUE(removed.expired());
+  for (size_t i = 0; i < v.size(); ++i) {
+    EXPECT_NE(*v[i] % 3, 0);
+  }
+  EXPECT_EQ(*v[0], 1);
+  EXPECT_EQ(*v[5], 8);
+  EXPECT_EQ(s21::erase_if(v, [](const auto&) { return false; }), 0U);
+}
+
 TEST(VectorTest, Modifiers_push_back_1) {
   s21::Vector<int> s21_v;
   std::vector<int> std_v;
@@ -695,6 +781,207 @@ TEST(VectorTest, Modifiers_swap_4) {
   EXPECT_EQ(s21_v_copy.capacity(), std_v_copy.capacity());
 }
 
+struct Record {
+  static int copies;
+  static int moves;
+
+  Record(int id, std::string name) : id(id), name(std::move(name)) {}
+  Record(const Record& other) : id(other.id), name(other.name) { ++copies; }
+  Record(Record&& other) noexcept
+      : id(other.id), name(std::move(other.name)) {
+    ++moves;
+  }
+  Record& operator=(const Record& other) {
+    id = other.id;
+    name = other.name;
+    ++copies;
+    return *this;
+  }
+  Record& operator=(Record&& other) noexcept {
+    id = other.id;
+    name = std::move(other.name);
+    ++moves;
+    return *this;
+  }
+
+  int id;
+  std::string name;
+};
+
+int Record::copies = 0;
+int Record::moves = 0;
+
+TEST(VectorTest, Modifiers_emplace_back_1) {
+  s21::Vector<Record> v;
+  v.reserve(4);
+  Record::copies = Record::moves = 0;
+  Record& r = v.emplace_back(1, "one");
+  v.emplace_back(2, "two");
+
+  EXPECT_EQ(&r, &v[0]);
+  EXPECT_EQ(v.size(), 2U);
+  EXPECT_EQ(v[1].name, "two");
+  EXPECT_EQ(Record::copies, 0);
+  EXPECT_EQ(Record::moves, 0);
+}
+
+TEST(VectorTest, Modifiers_emplace_back_2) {
+  s21::Vector<Record> v;
+  for (int i = 0; i < 100; ++i) {
+    v.emplace_back(i, std::to_string(i));
+  }
+  EXPECT_EQ(v.size(), 100U);
+  EXPECT_EQ(v[57].id, 57);
+  EXPECT_EQ(v[99].name, "99");
+}
+
+TEST(VectorTest, Modifiers_emplace_back_aliasing) {
+  s21::Vector<std::string> v{"first", "second"};
+  ASSERT_EQ(v.size(), v.capacity());
+  v.emplace_back(v[0]);
+  v.push_back(v[1]);
+  EXPECT_EQ(v[2], "first");
+  EXPECT_EQ(v[3], "second");
+}
+
+TEST(VectorTest, Modifiers_push_back_rvalue) {
+  s21::Vector<Record> v;
+  v.reserve(2);
+  Record::copies = Record::moves = 0;
+  Record record(7, "seven");
+  v.push_back(std::move(record));
+  EXPECT_EQ(Record::copies, 0);
+  EXPECT_EQ(Record::moves, 1);
+  EXPECT_EQ(v[0].name, "seven");
+}
+
+TEST(VectorTest, Modifiers_emplace_1) {
+  s21::Vector<Record> v;
+  v.emplace_back(1, "one");
+  v.emplace_back(3, "three");
+  auto it = v.emplace(v.begin() + 1, 2, "two");
+  EXPECT_EQ(it->id, 2);
+  v.emplace(v.begin(), 0, "zero");
+  v.emplace(v.end(), 4, "four");
+
+  ASSERT_EQ(v.size(), 5U);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(v[i].id, i);
+  }
+  EXPECT_EQ(v[2].name, "two");
+}
+
+TEST(VectorTest, Modifiers_emplace_2) {
+  s21::Vector<std::string> v{"a", "b", "c"};
+  v.reserve(10);
+  v.emplace(v.begin(), v[2]);
+  v.insert(v.begin() + 1, std::string("x"));
+  EXPECT_EQ(v[0], "c");
+  EXPECT_EQ(v[1], "x");
+  EXPECT_EQ(v[2], "a");
+  EXPECT_EQ(v[4], "c");
+  EXPECT_EQ(v.size(), 5U);
+}
+
+TEST(VectorTest, Modifiers_append_range) {
+  s21::Vector<int> v{1, 2};
+  std::list<int> l{3, 4, 5};
+  v.append(l.begin(), l.end());
+  s21::Vector<int> w{6, 7};
+  v.append(w);
+  EXPECT_EQ(v.size(), 7U);
+  for (size_t i = 0; i < v.size(); ++i) {
+    EXPECT_EQ(v[i], static_cast<int>(i) + 1);
+  }
+}
+
+TEST(VectorTest, Modifiers_append_self) {
+  s21::Vector<std::string> v{"a", "b", "c"};
+  v.shrink_to_fit();
+  v.append(v);
+  v.append(v.begin(), v.begin() + 2);
+  EXPECT_EQ(v.size(), 8U);
+  EXPECT_EQ(v[3], "a");
+  EXPECT_EQ(v[5], "c");
+  EXPECT_EQ(v[6], "a");
+  EXPECT_EQ(v[7], "b");
+}
+
+TEST(VectorTest, Modifiers_append_input_iterator) {
+  std::istringstream in("4 5 6");
+  s21::Vector<int> v{1};
+  v.append(std::istream_iterator<int>(in), std::istream_iterator<int>());
+  EXPECT_EQ(v.size(), 4U);
+  EXPECT_EQ(v[3], 6);
+}
+
+TEST(VectorTest, Modifiers_insert_range) {
+  int src[] = {7, 8, 9};
+  s21::Vector<int> v{1, 2, 3};
+  auto it = v.insert(v.begin() + 1, src, src + 3);
+  EXPECT_EQ(*it, 7);
+  v.reserve(20);
+  v.insert(v.end(), src, src + 2);
+  v.insert(v.begin(), v.begin() + 4, v.begin() + 6);
+  std::vector<int> expected{2, 3, 1, 7, 8, 9, 2, 3, 7, 8};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < v.size(); ++i) {
+    EXPECT_EQ(v[i], expected[i]);
+  }
+}
+
+TEST(VectorTest, Modifiers_assign_range) {
+  s21::Vector<std::string> v{"a", "b", "c", "d"};
+  std::vector<std::string> src{"x", "y"};
+  v.assign(src.begin(), src.end());
+  EXPECT_EQ(v.size(), 2U);
+  EXPECT_EQ(v[1], "y");
+  EXPECT_EQ(v.capacity(), 4U);
+  std::vector<std::string> big(6, "z");
+  v.assign(big.begin(), big.end());
+  EXPECT_EQ(v.size(), 6U);
+  EXPECT_EQ(v[5], "z");
+  v.assign(v.begin() + 4, v.end());
+  EXPECT_EQ(v.size(), 2U);
+}
+
+TEST(VectorTest, Modifiers_resize) {
+  s21::Vector<int> v{1, 2, 3};
+  v.resize(5);
+  EXPECT_EQ(v.size(), 5U);
+  EXPECT_EQ(v[2], 3);
+  EXPECT_EQ(v[4], 0);
+  size_t capacity = v.capacity();
+  v.resize(1);
+  EXPECT_EQ(v.size(), 1U);
+  EXPECT_EQ(v.capacity(), capacity);
+  v.resize(3, 7);
+  EXPECT_EQ(v[0], 1);
+  EXPECT_EQ(v[2], 7);
+}
+
+TEST(VectorTest, Modifiers_resize_aliasing) {
+  s21::Vector<std::string> v{"abc"};
+  v.shrink_to_fit();
+  v.resize(4, v[0]);
+  EXPECT_EQ(v.size(), 4U);
+  EXPECT_EQ(v[3], "abc");
+}
+
+TEST(VectorTest, Modifiers_resize_for_overwrite) {
+  s21::Vector<char> v(8, s21::default_init);
+  EXPECT_EQ(v.size(), 8U);
+  EXPECT_EQ(v.capacity(), 8U);
+  v.resize_for_overwrite(64);
+  EXPECT_EQ(v.size(), 64U);
+  std::fill(v.begin(), v.end(), 'x');
+  EXPECT_EQ(v[63], 'x');
+
+  s21::Vector<std::string> s(3, s21::default_init);
+  s.resize_for_overwrite(5);
+  EXPECT_TRUE(s[4].empty());
+}
+
 TEST(VectorTest, Helpers_add_memotysize_1) {
   int n = 1000;
   s21::Vector<int> s21_v(n);
@@ -720,6 +1007,781 @@ TEST(VectorTest, Helpers_add_memotysize_3) {
   EXPECT_EQ(s21_v.size(), n + 3);
 }
 
+// SMALL VECTOR
+template <typename V>
+bool stored_inline(const V& v) {
+  auto p = reinterpret_cast<const char*>(&v[0]);
+  auto self = reinterpret_cast<const char*>(&v);
+  return p >= self && p < self + sizeof(v);
+}
+
+TEST(SmallVectorTest, StaysInline) {
+  s21::SmallVector<int, 4> v{1, 2, 3};
+  v.push_back(4);
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_TRUE(stored_inline(v));
+  EXPECT_EQ(v.capacity(), 4U);
+  v.push_back(5);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_FALSE(stored_inline(v));
+  EXPECT_EQ(v.size(), 5U);
+  EXPECT_EQ(v[4], 5);
+  v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v[3], 4);
+}
+
+TEST(SmallVectorTest, SharesVectorApi) {
+  s21::SmallVector<std::string, 2> v;
+  v.insert_many_back("a", "b");
+  v.insert(v.begin(), std::string("c"));
+  int count = 0;
+  for (s21::Vector<std::string>::iterator it = v.begin(); it != v.end();
+       ++it) {
+    ++count;
+  }
+  EXPECT_EQ(count, 3);
+  EXPECT_EQ(v.front(), "c");
+  EXPECT_EQ(v.back(), "b");
+  EXPECT_EQ(s21::erase_if(v, [](const std::string& s) { return s < "c"; }),
+            2U);
+  EXPECT_EQ(v.size(), 1U);
+  static_assert(!std::is_convertible_v<s21::SmallVector<std::string, 2>*,
+                                       s21::Vector<std::string>*>);
+}
+
+TEST(SmallVectorTest, CopyAndMove) {
+  s21::SmallVector<std::string, 2> small{"a", "b"};
+  s21::SmallVector<std::string, 2> copy(small);
+  s21::SmallVector<std::string, 2> moved(std::move(small));
+  EXPECT_EQ(copy[1], "b");
+  EXPECT_EQ(moved[1], "b");
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_TRUE(small.empty());
+
+  s21::SmallVector<std::string, 2> big{"a", "b", "c"};
+  const std::string* heap = &big[0];
+  moved = std::move(big);
+  EXPECT_EQ(&moved[0], heap);
+  EXPECT_TRUE(big.empty());
+  EXPECT_TRUE(big.is_inline());
+  big.push_back("d");
+  EXPECT_EQ(big[0], "d");
+}
+
+TEST(SmallVectorTest, ConvertsToAndFromVector) {
+  s21::Vector<int> v{1, 2, 3, 4, 5};
+  const int* heap = &v[0];
+  s21::SmallVector<int, 2> small(std::move(v));
+  EXPECT_EQ(&small[0], heap);
+  EXPECT_EQ(small.size(), 5U);
+
+  s21::Vector<int> back(std::move(small));
+  EXPECT_EQ(&back[0], heap);
+
+  s21::SmallVector<int, 8> inline_only{7, 8};
+  s21::Vector<int> from_inline(std::move(inline_only));
+  EXPECT_EQ(from_inline.size(), 2U);
+  EXPECT_EQ(from_inline[1], 8);
+  EXPECT_FALSE(stored_inline(from_inline));
+}
+
+TEST(SmallVectorTest, Swap) {
+  s21::SmallVector<int, 2> a{1};
+  s21::SmallVector<int, 2> b{2, 3, 4};
+  a.swap(b);
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(a[2], 4);
+  EXPECT_EQ(b.size(), 1U);
+  EXPECT_EQ(b[0], 1);
+  s21::Vector<int> v{9};
+  b.swap(v);
+  EXPECT_EQ(b[0], 9);
+  EXPECT_EQ(v[0], 1);
+}
+
+// STATIC VECTOR
+constexpr int static_vector_sum() {
+  s21::StaticVector<int, 8> v{1, 2, 3};
+  v.push_back(4);
+  v.emplace_back(5);
+  v.pop_back();
+  v.resize(6, 10);
+  int sum = 0;
+  for (size_t i = 0; i < v.size(); ++i) sum += v[i];
+  return sum;
+}
+
+TEST(StaticVectorTest, Constexpr) {
+#if __cplusplus >= 202002L
+  static_assert(static_vector_sum() == 30);
+#endif
+  static_assert(std::is_trivially_copyable_v<s21::StaticVector<int, 4>>);
+  EXPECT_EQ(static_vector_sum(), 30);
+}
+
+TEST(StaticVectorTest, StoresInline) {
+  s21::StaticVector<std::string, 4> v{"a", "b"};
+  v.insert(v.begin() + 1, std::string("c"));
+  v.insert_many_back("d");
+  EXPECT_TRUE(stored_inline(v));
+  EXPECT_EQ(v.size(), 4U);
+  EXPECT_EQ(v.capacity(), 4U);
+  EXPECT_EQ(v[1], "c");
+  EXPECT_EQ(v.back(), "d");
+  EXPECT_EQ(*v.erase(v.begin()), "c");
+  EXPECT_EQ(v.front(), "c");
+
+  s21::StaticVector<std::string, 4> copy(v);
+  s21::StaticVector<std::string, 4> moved(std::move(v));
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(moved[2], "d");
+  copy.swap(v);
+  EXPECT_EQ(v.size(), 3U);
+  EXPECT_TRUE(copy.empty());
+  auto last = v.erase(v.begin() + 1, v.end());
+  EXPECT_EQ(last, v.end());
+  EXPECT_EQ(v.size(), 1U);
+  EXPECT_EQ(v[0], "c");
+}
+
+TEST(StaticVectorTest, OverflowThrows) {
+  s21::StaticVector<int, 2> v{1, 2};
+  EXPECT_THROW(v.push_back(3), std::length_error);
+  int src[] = {1, 2, 3};
+  EXPECT_THROW(v.assign(src, src + 3), std::length_error);
+  EXPECT_EQ(v.size(), 2U);
+}
+
+TEST(StaticVectorTest, OverflowReturnsFalse) {
+  s21::StaticVector<int, 3, s21::OverflowPolicy::kReturnFalse> v;
+  EXPECT_TRUE(v.push_back(1));
+  EXPECT_TRUE(v.insert_many_back(2, 3));
+  EXPECT_FALSE(v.push_back(4));
+  EXPECT_TRUE(v.insert(v.begin(), 0) == v.end());
+  std::vector<int> src{5, 6};
+  v.pop_back();
+  EXPECT_FALSE(v.append(src.begin(), src.end()));
+  EXPECT_EQ(v.size(), 2U);
+  EXPECT_FALSE(v.resize(4));
+  EXPECT_TRUE(v.resize(3));
+}
+
+TEST(StaticVectorTest, OverflowAsserts) {
+  using Vec = s21::StaticVector<int, 1, s21::OverflowPolicy::kAssert>;
+  Vec v{1};
+  EXPECT_DEBUG_DEATH(v.push_back(2), "capacity exceeded");
+}
+
+// SIMD
+template <typename T>
+void check_simd_against_std() {
+  for (s21::simd::Isa isa : {s21::simd::Isa::kScalar, s21::simd::Isa::kSse2,
+                             s21::simd::Isa::kAvx2}) {
+    s21::simd::set_isa(isa);
+    for (size_t size = 0; size < 80; ++size) {
+      std::vector<T> v(size);
+      for (size_t i = 0; i < size; ++i) {
+        v[i] = static_cast<T>((i * 37 + 11) % 23);
+      }
+      const T* p = v.data();
+      T needle = static_cast<T>(5);
+      EXPECT_EQ(s21::simd::find(p, size, needle),
+                std::find(v.begin(), v.end(), needle) - v.begin());
+      EXPECT_EQ(s21::simd::count(p, size, needle),
+                static_cast<size_t>(std::count(v.begin(), v.end(), needle)));
+      EXPECT_EQ(s21::simd::min_element(p, size),
+                std::min_element(v.begin(), v.end()) - v.begin());
+      EXPECT_EQ(s21::simd::max_element(p, size),
+                std::max_element(v.begin(), v.end()) - v.begin());
+      EXPECT_EQ(s21::simd::accumulate(p, size, T{}),
+                std::accumulate(v.begin(), v.end(), T{}));
+      std::vector<T> w(v);
+      EXPECT_TRUE(s21::simd::equal(p, w.data(), size));
+      if (size) {
+        w[size - 1] = static_cast<T>(100);
+        EXPECT_FALSE(s21::simd::equal(p, w.data(), size));
+      }
+      s21::simd::fill(w.data(), size, needle);
+      EXPECT_EQ(s21::simd::count(w.data(), size, needle), size);
+    }
+  }
+  s21::simd::set_isa(s21::simd::detected_isa());
+}
+
+TEST(SimdTest, MatchesStdAlgorithms) {
+  check_simd_against_std<int8_t>();
+  check_simd_against_std<int32_t>();
+  check_simd_against_std<int64_t>();
+  check_simd_against_std<uint16_t>();
+  check_simd_against_std<float>();
+  check_simd_against_std<double>();
+}
+
+TEST(SimdTest, CountLargeBytes) {
+  std::vector<char> v(100000, 'a');
+  v[5000] = 'b';
+  EXPECT_EQ(s21::simd::count(v.data(), v.size(), 'a'), v.size() - 1);
+}
+
+TEST(SimdTest, FloatingPointEdgeCases) {
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  for (s21::simd::Isa isa : {s21::simd::Isa::kScalar, s21::simd::Isa::kSse2,
+                             s21::simd::Isa::kAvx2}) {
+    s21::simd::set_isa(isa);
+    std::vector<double> v{nan, 3.0, 1.0, 2.0, 1.0, 5.0, 4.0, 0.5, 6.0};
+    EXPECT_EQ(s21::simd::min_element(v.data(), v.size()), 0U);
+    v[0] = 7.0;
+    v[3] = nan;
+    EXPECT_EQ(s21::simd::min_element(v.data(), v.size()), 7U);
+    EXPECT_EQ(s21::simd::max_element(v.data(), v.size()), 0U);
+    EXPECT_EQ(s21::simd::find(v.data(), v.size(), nan), v.size());
+  }
+  s21::simd::set_isa(s21::simd::detected_isa());
+}
+
+TEST(SimdTest, Memchr) {
+  std::string text(200, '.');
+  text[150] = 'x';
+  EXPECT_EQ(s21::simd::memchr(text.data(), 'x', text.size()),
+            text.data() + 150);
+  EXPECT_EQ(s21::simd::memchr(text.data(), 'x', 150), nullptr);
+}
+
+TEST(SimdTest, Containers) {
+  s21::Vector<int> v{4, 8, 15, 16, 23, 42, 8};
+  EXPECT_EQ(s21::simd::find(v, 16), 3U);
+  EXPECT_EQ(s21::simd::count(v, 8), 2U);
+  EXPECT_EQ(s21::simd::max_element(v), 5U);
+  EXPECT_EQ(s21::simd::accumulate(v), 116);
+
+  s21::Array<float, 4> a = {1.5f, -2.0f, 3.0f, 0.0f};
+  EXPECT_EQ(s21::simd::min_element(a), 1U);
+  s21::simd::fill(a, 2.0f);
+  EXPECT_EQ(s21::simd::accumulate(a), 8.0f);
+
+  s21::StaticVector<int, 8> sv{4, 8, 15, 16, 23, 42, 8};
+  EXPECT_TRUE(s21::simd::equal(v, sv));
+  sv.pop_back();
+  EXPECT_FALSE(s21::simd::equal(v, sv));
+}
+
+TEST(SpanTest, FromContainers) {
+  s21::Vector<int> v{1, 2, 3, 4};
+  s21::Span<int> sv(v);
+  EXPECT_EQ(sv.data(), v.data());
+  EXPECT_EQ(sv.size(), 4U);
+  sv[0] = 10;
+  EXPECT_EQ(v[0], 10);
+
+  const s21::Array<int, 3> a = {5, 6, 7};
+  s21::Span<const int> sa(a);
+  EXPECT_EQ(sa.size(), 3U);
+  EXPECT_EQ(sa.back(), 7);
+
+  s21::StaticVector<int, 8> st{1, 2};
+  s21::Span<int> sst(st);
+  EXPECT_EQ(sst.size(), 2U);
+  EXPECT_EQ(sst.size_bytes(), 2 * sizeof(int));
+
+  int raw[] = {1, 2, 3};
+  s21::Span<int> sr(raw, 3);
+  s21::Span<const int> sc = sr;
+  EXPECT_EQ(sc.front(), 1);
+  EXPECT_EQ(std::accumulate(sc.begin(), sc.end(), 0), 6);
+
+  EXPECT_TRUE(s21::Span<int>().empty());
+  EXPECT_THROW(sr.at(3), std::out_of_range);
+  EXPECT_FALSE((std::is_constructible_v<s21::Span<int>,
+                                        const s21::Vector<int>&>));
+}
+
+TEST(SpanTest, Slicing) {
+  s21::Vector<int> v{0, 1, 2, 3, 4, 5};
+  s21::Span<int> s(v);
+  EXPECT_EQ(s.first(2).back(), 1);
+  EXPECT_EQ(s.last(2).front(), 4);
+  EXPECT_EQ(s.subspan(2).size(), 4U);
+  EXPECT_EQ(s.subspan(2, 3).back(), 4);
+  EXPECT_TRUE(s.subspan(6).empty());
+  EXPECT_THROW(s.first(7), std::out_of_range);
+  EXPECT_THROW(s.last(7), std::out_of_range);
+  EXPECT_THROW(s.subspan(7), std::out_of_range);
+  EXPECT_THROW(s.subspan(4, 3), std::out_of_range);
+}
+
+TEST(SpanTest, Simd) {
+  s21::Vector<float> v(100, 1.0f);
+  s21::Span<float> s(v);
+  s21::simd::fill(s.subspan(10, 20), 3.0f);
+  EXPECT_EQ(s21::simd::accumulate(s), 140.0f);
+  s21::Span<const float> cs(v);
+  EXPECT_EQ(s21::simd::find(cs, 3.0f), 10U);
+  EXPECT_EQ(s21::simd::count(cs.last(80), 3.0f), 10U);
+  EXPECT_TRUE(s21::simd::equal(cs.subspan(10, 20), s.subspan(10, 20)));
+}
+
+// Returns the path of a fresh empty file that is removed when the object
+// goes out of scope.
+struct TempFile {
+  TempFile() {
+    char tmpl[] = "/tmp/s21_mmap_XXXXXX";
+    int fd = mkstemp(tmpl);
+    close(fd);
+    path = tmpl;
+  }
+  ~TempFile() { std::remove(path.c_str()); }
+  std::string path;
+};
+
+TEST(MmapVectorTest, AppendAndReopen) {
+  TempFile file;
+  {
+    s21::MmapVector<int> v(file.path);
+    EXPECT_TRUE(v.empty());
+    for (int i = 0; i < 10000; ++i) {
+      v.push_back(i);
+    }
+    v.insert_many_back(1, 2, 3);
+    v.append({7, 8});
+    EXPECT_EQ(v.size(), 10005U);
+    EXPECT_GE(v.capacity(), v.size());
+    v.pop_back();
+    EXPECT_EQ(v.back(), 7);
+  }
+  std::ifstream in(file.path, std::ios::binary | std::ios::ate);
+  EXPECT_EQ(static_cast<size_t>(in.tellg()), 10004 * sizeof(int));
+
+  s21::MmapVector<int> v(file.path);
+  EXPECT_EQ(v.size(), 10004U);
+  EXPECT_EQ(v[9999], 9999);
+  EXPECT_EQ(std::accumulate(v.begin(), v.begin() + 100, 0), 4950);
+  v.resize(3);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 3U);
+  v.resize(5, 42);
+  EXPECT_EQ(v[4], 42);
+  v.close();
+  EXPECT_FALSE(v.is_open());
+
+  s21::MmapVector<int> t(file.path, s21::MmapMode::kTruncate);
+  EXPECT_TRUE(t.empty());
+}
+
+TEST(MmapVectorTest, ReadOnly) {
+  TempFile file;
+  {
+    std::ofstream out(file.path, std::ios::binary);
+    double values[] = {1.5, 2.5, 3.5};
+    out.write(reinterpret_cast<const char*>(values), sizeof(values));
+  }
+  const s21::MmapVector<double> v(file.path, s21::MmapMode::kReadOnly);
+  EXPECT_TRUE(v.read_only());
+  EXPECT_EQ(v.size(), 3U);
+  EXPECT_EQ(s21::simd::accumulate(v), 7.5);
+
+  s21::MmapVector<double> w(file.path, s21::MmapMode::kReadOnly);
+  w.advise(s21::MmapAdvice::kSequential);
+  EXPECT_THROW(w.push_back(1.0), std::runtime_error);
+  EXPECT_THROW(w.clear(), std::runtime_error);
+  EXPECT_THROW(w[0] = 42.0, std::runtime_error);
+  EXPECT_THROW(w.at(1), std::runtime_error);
+  EXPECT_THROW(w.data(), std::runtime_error);
+  EXPECT_THROW(w.begin(), std::runtime_error);
+  EXPECT_EQ(std::as_const(w)[0], v[0]);
+  EXPECT_EQ(w.size(), 3U);
+}
+
+TEST(MmapVectorTest, MoveAndErrors) {
+  TempFile file;
+  s21::MmapVector<int> v(file.path);
+  v.append({1, 2, 3});
+  v.advise(s21::MmapAdvice::kRandom);
+  s21::MmapVector<int> w(std::move(v));
+  EXPECT_FALSE(v.is_open());
+  EXPECT_EQ(w.size(), 3U);
+  EXPECT_THROW(v.push_back(1), std::runtime_error);
+  v = std::move(w);
+  EXPECT_EQ(v[2], 3);
+  EXPECT_THROW(v.at(3), std::out_of_range);
+  EXPECT_THROW(v.reserve(v.max_size() + 1), std::length_error);
+  EXPECT_THROW(v.resize(v.max_size() + 1), std::length_error);
+
+  v.shrink_to_fit();
+  v.append(v.begin(), v.end());
+  v.append(v.data(), v.data() + v.size());
+  EXPECT_EQ(v.size(), 12U);
+  EXPECT_EQ(v[11], 3);
+  EXPECT_EQ(std::accumulate(v.begin(), v.end(), 0), 24);
+
+  EXPECT_THROW(s21::MmapVector<int>("/nonexistent/dir/file",
+                                    s21::MmapMode::kReadOnly),
+               std::runtime_error);
+}
+
+TEST(DequeTest, BothEnds) {
+  s21::Deque<int> d;
+  std::deque<int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    if (i % 3 == 0) {
+      d.push_front(i);
+      expected.push_front(i);
+    } else {
+      d.push_back(i);
+      expected.push_back(i);
+    }
+    if (i % 7 == 0) {
+      d.pop_front();
+      expected.pop_front();
+    }
+    if (i % 11 == 0 && !expected.empty()) {
+      d.pop_back();
+      expected.pop_back();
+    }
+  }
+  ASSERT_EQ(d.size(), expected.size());
+  EXPECT_TRUE(std::equal(d.begin(), d.end(), expected.begin()));
+  EXPECT_EQ(d.front(), expected.front());
+  EXPECT_EQ(d.back(), expected.back());
+  EXPECT_EQ(d[1234], expected[1234]);
+  EXPECT_THROW(d.at(d.size()), std::out_of_range);
+
+  while (!d.empty()) {
+    d.pop_front();
+  }
+  d.push_front(1);
+  d.push_back(2);
+  EXPECT_EQ(d.front(), 1);
+  EXPECT_EQ(d.back(), 2);
+}
+
+TEST(DequeTest, StableReferences) {
+  s21::Deque<std::string> d{"middle"};
+  std::string* middle = &d.front();
+  for (int i = 0; i < 5000; ++i) {
+    d.push_back(std::to_string(i));
+    d.push_front(std::to_string(-i));
+  }
+  EXPECT_EQ(middle, &d[5000]);
+  EXPECT_EQ(*middle, "middle");
+}
+
+TEST(DequeTest, RandomAccessIterators) {
+  s21::Deque<int> d;
+  for (int i = 0; i < 3000; ++i) {
+    d.push_front(i * 7919 % 3001);
+  }
+  std::sort(d.begin(), d.end());
+  EXPECT_TRUE(std::is_sorted(d.cbegin(), d.cend()));
+  EXPECT_EQ(d.end() - d.begin(), 3000);
+  auto it = d.begin() + 1500;
+  EXPECT_EQ(it[10], d[1510]);
+  s21::Deque<int>::const_iterator cit = it;
+  EXPECT_EQ(cit - d.cbegin(), 1500);
+}
+
+TEST(DequeTest, CopyMoveAndInsertMany) {
+  s21::Deque<int> d;
+  d.insert_many_back(4, 5, 6);
+  d.insert_many_front(3, 2, 1);
+  s21::Deque<int> copy(d);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(),
+                         std::vector<int>{1, 2, 3, 4, 5, 6}.begin()));
+  s21::Deque<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 6U);
+  copy = moved;
+  moved.clear();
+  moved.swap(copy);
+  EXPECT_EQ(moved.back(), 6);
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(DequeTest, StackAndQueueSequence) {
+  s21::stack<int, s21::Deque<int>> s{1, 2, 3};
+  s.push(4);
+  EXPECT_EQ(s.top(), 4);
+  s.pop();
+  EXPECT_EQ(s.top(), 3);
+  EXPECT_EQ(s.size(), 3U);
+
+  s21::queue<int, s21::Deque<int>> q{1, 2, 3};
+  q.insert_many(4, 5);
+  q.pop();
+  EXPECT_EQ(q.front(), 2);
+  EXPECT_EQ(q.back(), 5);
+  EXPECT_EQ(q.size(), 4U);
+}
+
+TEST(RingBufferTest, WrapsAndGrows) {
+  s21::RingBuffer<int> r;
+  std::deque<int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    r.push_back(i);
+    expected.push_back(i);
+    if (i % 3 == 0) {
+      r.pop_front();
+      expected.pop_front();
+    }
+    if (i % 5 == 0) {
+      r.push_front(-i);
+      expected.push_front(-i);
+    }
+  }
+  ASSERT_EQ(r.size(), expected.size());
+  EXPECT_TRUE(std::equal(r.begin(), r.end(), expected.begin()));
+  EXPECT_EQ(r.capacity() & (r.capacity() - 1), 0U);
+  EXPECT_EQ(r.back(), 999);
+  EXPECT_THROW(r.at(r.size()), std::out_of_range);
+
+  r.push_back(r.front());
+  EXPECT_EQ(r.back(), expected.front());
+}
+
+TEST(RingBufferTest, BulkCopiesWrappedRuns) {
+  s21::RingBuffer<int> r;
+  r.reserve(8);
+  size_t capacity = r.capacity();
+  int in[] = {1, 2, 3, 4, 5, 6};
+  r.append(in, 6);
+  int out[8] = {};
+  EXPECT_EQ(r.pop_front_many(out, 4), 4U);
+  r.append(in, 6);
+  EXPECT_EQ(r.capacity(), capacity);
+  EXPECT_EQ(r.pop_front_many(out, 8), 8U);
+  int expected[] = {5, 6, 1, 2, 3, 4, 5, 6};
+  EXPECT_TRUE(std::equal(out, out + 8, expected));
+  EXPECT_EQ(r.pop_front_many(out, 8), 0U);
+
+  s21::RingBuffer<std::string> strings{"a", "b"};
+  std::string words[] = {"c", "d"};
+  strings.append(words, 2);
+  std::string taken[3];
+  EXPECT_EQ(strings.pop_front_many(taken, 3), 3U);
+  EXPECT_EQ(taken[2], "c");
+  EXPECT_EQ(strings.front(), "d");
+}
+
+TEST(RingBufferTest, QueueBulkOps) {
+  s21::queue<int, s21::RingBuffer<int>> q{1, 2};
+  s21::Vector<int> batch{3, 4, 5};
+  q.push_many(batch);
+  q.insert_many(6, 7);
+  EXPECT_EQ(q.size(), 7U);
+  EXPECT_EQ(q.back(), 7);
+  int out[10];
+  EXPECT_EQ(q.pop_many(out, 5), 5U);
+  EXPECT_EQ(out[4], 5);
+  EXPECT_EQ(q.front(), 6);
+
+  s21::queue<int> list_queue;
+  list_queue.push_many(batch);
+  EXPECT_EQ(list_queue.pop_many(out, 10), 3U);
+  EXPECT_EQ(out[2], 5);
+  EXPECT_TRUE(list_queue.empty());
+}
+
+TEST(UnrolledListTest, BothEnds) {
+  s21::UnrolledList<int> list;
+  std::deque<int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 3 == 0) {
+      list.push_front(i);
+      expected.push_front(i);
+    } else {
+      list.push_back(i);
+      expected.push_back(i);
+    }
+    if (i % 7 == 0) {
+      list.pop_front();
+      expected.pop_front();
+    }
+  }
+  ASSERT_EQ(list.size(), expected.size());
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin()));
+  EXPECT_TRUE(std::equal(expected.rbegin(), expected.rend(),
+                         std::make_reverse_iterator(list.end())));
+  EXPECT_LE(list.node_count(),
+            expected.size() / s21::UnrolledList<int>::kNodeCapacity + 2);
+
+  const int& front = list.front();
+  list.push_front(-1);
+  list.push_back(-2);
+  EXPECT_EQ(*++list.begin(), front);
+  EXPECT_EQ(list.back(), -2);
+  while (!list.empty()) {
+    list.pop_back();
+  }
+  EXPECT_EQ(list.node_count(), 0U);
+  EXPECT_THROW(list.pop_front(), std::runtime_error);
+}
+
+TEST(UnrolledListTest, InsertEraseSplitsAndMerges) {
+  s21::UnrolledList<std::string> list;
+  std::list<std::string> expected;
+  unsigned seed = 11;
+  for (int i = 0; i < 3000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    size_t at = expected.empty() ? 0 : (seed >> 8) % (expected.size() + 1);
+    auto it = list.begin();
+    auto expected_it = expected.begin();
+    for (size_t j = 0; j < at; ++j, ++it, ++expected_it) {
+    }
+    if (i < 2000 || seed % 3 == 0 || it == list.end()) {
+      std::string value = std::to_string(i);
+      EXPECT_EQ(*list.insert(it, value), value);
+      expected.insert(expected_it, value);
+    } else {
+      auto next = list.erase(it);
+      auto expected_next = expected.erase(expected_it);
+      if (expected_next == expected.end()) {
+        EXPECT_EQ(next, list.end());
+      } else {
+        EXPECT_EQ(*next, *expected_next);
+      }
+    }
+  }
+  ASSERT_EQ(list.size(), expected.size());
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin()));
+
+  size_t nodes = list.node_count();
+  for (auto it = list.begin(); it != list.end();) {
+    it = list.erase(it);
+    if (it != list.end()) {
+      ++it;
+    }
+  }
+  EXPECT_LT(list.node_count(), nodes);
+  size_t count = 0;
+  for (auto it = expected.begin(); it != expected.end(); ++count) {
+    it = count % 2 ? std::next(it) : expected.erase(it);
+  }
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(),
+                         expected.end()));
+}
+
+TEST(UnrolledListTest, CopyMoveAndSwap) {
+  s21::UnrolledList<std::string> list1{"a", "b", "c"};
+  s21::UnrolledList<std::string> list2(list1);
+  list2.insert_many_back("d", "e");
+  list2.insert_many_front("z");
+  EXPECT_EQ(list1.size(), 3U);
+  EXPECT_EQ(list2.front(), "z");
+  EXPECT_EQ(list2.back(), "e");
+
+  s21::UnrolledList<std::string> list3(std::move(list2));
+  EXPECT_TRUE(list2.empty());
+  EXPECT_EQ(list2.begin(), list2.end());
+  list1.swap(list3);
+  EXPECT_EQ(list1.size(), 6U);
+  EXPECT_EQ(list3.back(), "c");
+
+  list2 = list1;
+  list3 = std::move(list1);
+  EXPECT_TRUE(std::equal(list2.begin(), list2.end(), list3.begin(),
+                         list3.end()));
+
+  std::pmr::monotonic_buffer_resource resource;
+  s21::pmr::UnrolledList<int> list4({1, 2, 3}, &resource);
+  s21::pmr::UnrolledList<int> list5(std::move(list4),
+                                    std::pmr::new_delete_resource());
+  EXPECT_EQ(list5.back(), 3);
+  EXPECT_TRUE(list4.empty());
+}
+
+struct Tracked {
+  explicit Tracked(int value) : value(value) {}
+  int value;
+  s21::ListHook active;
+  s21::ListHook per_client;
+};
+
+using ActiveList = s21::IntrusiveList<Tracked, &Tracked::active>;
+using ClientList = s21::IntrusiveList<Tracked, &Tracked::per_client>;
+
+TEST(IntrusiveListTest, SeveralMemberships) {
+  s21::Vector<Tracked> items;
+  for (int i = 0; i < 6; ++i) {
+    items.push_back(Tracked(i));
+  }
+  ActiveList active;
+  ClientList client;
+  for (auto& item : items) {
+    active.push_back(item);
+    if (item.value % 2) {
+      client.push_front(item);
+    }
+  }
+  EXPECT_EQ(active.size(), 6U);
+  EXPECT_EQ(client.size(), 3U);
+  EXPECT_EQ(client.front().value, 5);
+  EXPECT_EQ(&active.back(), &items[5]);
+  EXPECT_THROW(active.push_back(items[0]), std::invalid_argument);
+
+  items[3].active.unlink();
+  items[3].per_client.unlink();
+  EXPECT_FALSE(items[3].active.is_linked());
+  EXPECT_EQ(active.size(), 5U);
+  EXPECT_EQ(client.size(), 2U);
+
+  auto it = active.erase(active.iterator_to(items[1]));
+  EXPECT_EQ(it->value, 2);
+  EXPECT_EQ((--active.end())->value, 5);
+  active.insert(it, items[3]);
+
+  std::string order;
+  for (const auto& item : active) {
+    order += std::to_string(item.value);
+  }
+  EXPECT_EQ(order, "03245");
+
+  Tracked copy(items[0]);
+  EXPECT_FALSE(copy.active.is_linked());
+  active.pop_front();
+  active.pop_back();
+  EXPECT_EQ(active.front().value, 3);
+}
+
+TEST(IntrusiveListTest, SpliceMoveAndTeardown) {
+  Tracked a(1), b(2), c(3), d(4);
+  ActiveList list1;
+  ActiveList list2;
+  list1.push_back(a);
+  list1.push_back(b);
+  list2.push_back(c);
+  list2.push_back(d);
+
+  list1.splice(list1.begin(), list2, --list2.end());
+  list1.splice(list1.end(), list2);
+  EXPECT_TRUE(list2.empty());
+  std::string order;
+  for (const auto& item : list1) {
+    order += std::to_string(item.value);
+  }
+  EXPECT_EQ(order, "4123");
+
+  list2.splice(list2.end(), list1, ++list1.begin(), list1.end());
+  EXPECT_EQ(list1.size(), 1U);
+  EXPECT_EQ(list2.front().value, 1);
+
+  ActiveList list3(std::move(list2));
+  EXPECT_TRUE(list2.empty());
+  list3.swap(list1);
+  EXPECT_EQ(list3.size(), 1U);
+  EXPECT_EQ(list1.back().value, 3);
+
+  {
+    Tracked e(5);
+    list1.push_back(e);
+    EXPECT_EQ(list1.size(), 4U);
+  }
+  EXPECT_EQ(list1.size(), 3U);
+  list1.clear();
+  EXPECT_FALSE(a.active.is_linked());
+  EXPECT_TRUE(d.active.is_linked());
+}
+
 // STACK
 TEST(StackTest, Constructor_default) {
   s21::stack<int> s21_stack;
@@ -1263,6 +2325,77 @@ TEST(ListTest, Merge_6) {
   EXPECT_TRUE(compare_lists(my_list1, std_list1));
 }
 
+TEST(ListTest, MergeRelinksNodes) {
+  s21::List<int> my_list1{1, 3, 3, 8};
+  s21::List<int> my_list2{0, 2, 3, 4, 9, 10};
+  const int* moved = &*++my_list2.begin();
+  my_list1.merge(my_list2);
+
+  std::list<int> std_list1{0, 1, 2, 3, 3, 3, 4, 8, 9, 10};
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_TRUE(my_list2.empty());
+  EXPECT_EQ(my_list2.begin(), my_list2.end());
+  EXPECT_EQ(&*++++my_list1.begin(), moved);
+
+  s21::List<std::pair<int, char>> my_list3{{5, 'a'}, {3, 'b'}, {3, 'c'}};
+  s21::List<std::pair<int, char>> my_list4{{4, 'd'}, {3, 'e'}, {1, 'f'}};
+  my_list3.merge(my_list4, [](const auto& a, const auto& b) {
+    return a.first > b.first;
+  });
+  std::string order;
+  for (auto& el : my_list3) {
+    order += el.second;
+  }
+  EXPECT_EQ(order, "adbcef");
+}
+
+TEST(ListTest, MergeKeepsSizesWhenCompareThrows) {
+  s21::List<int> my_list1{1, 4, 7, 10, 13};
+  s21::List<int> my_list2{0, 2, 3, 5, 6, 8, 9, 11};
+  int calls = 0;
+  auto comp = [&calls](int a, int b) {
+    if (++calls == 6) {
+      throw std::runtime_error("compare");
+    }
+    return a < b;
+  };
+  EXPECT_THROW(my_list1.merge(my_list2, comp), std::runtime_error);
+  EXPECT_EQ(my_list1.size(), static_cast<size_t>(std::distance(
+                                 my_list1.begin(), my_list1.end())));
+  EXPECT_EQ(my_list2.size(), static_cast<size_t>(std::distance(
+                                 my_list2.begin(), my_list2.end())));
+  EXPECT_GT(my_list1.size(), 5U);
+  EXPECT_EQ(my_list1.size() + my_list2.size(), 13U);
+}
+
+TEST(ListTest, MergeAcrossNodePools) {
+  s21::List<int> my_list1{1, 5};
+  s21::List<int> my_list2;
+  my_list2.reserve_nodes(2);
+  my_list2.insert_many_back(2, 6);
+  EXPECT_THROW(my_list1.merge(my_list2), std::invalid_argument);
+  EXPECT_EQ(my_list2.size(), 2U);
+  my_list1.share_node_pool(my_list2);
+  my_list1.merge(my_list2);
+  EXPECT_EQ(my_list1.node_pool(), my_list2.node_pool());
+
+  s21::List<int> my_list3;
+  my_list3.reserve_nodes(2);
+  my_list3.insert_many_back(0, 7);
+  EXPECT_THROW(my_list1.merge(my_list3), std::invalid_argument);
+  EXPECT_THROW(my_list1.share_node_pool(my_list3), std::invalid_argument);
+  EXPECT_TRUE(compare_lists(my_list3, std::list<int>{0, 7}));
+
+  s21::List<int> my_list4{0, 7};
+  my_list1.merge(my_list4);
+  EXPECT_TRUE(my_list4.empty());
+
+  std::list<int> std_list1{0, 1, 2, 5, 6, 7};
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  my_list1.clear();
+  EXPECT_EQ(my_list1.node_pool()->free_nodes(), 2U);
+}
+
 TEST(ListTest, Reverse_1) {
   s21::List<int> my_list{1, 2, 3, 4, 5};
   std::list<int> std_list{1, 2, 3, 4, 5};
@@ -1318,6 +2451,67 @@ TEST(ListTest, Splice_2) {
 }
 
 
+TEST(ListTest, SpliceRelinksNodes) {
+  s21::List<int> my_list1{1, 2, 3};
+  s21::List<int> my_list2{10, 20, 30, 40, 50};
+  const int* twenty = &*++my_list2.begin();
+
+  my_list1.splice(my_list1.end(), my_list2, ++my_list2.begin());
+  EXPECT_EQ(&my_list1.back(), twenty);
+  EXPECT_EQ(my_list1.size(), 4U);
+  EXPECT_EQ(my_list2.size(), 4U);
+
+  auto first = ++my_list2.begin();
+  auto last = --my_list2.end();
+  my_list1.splice(++my_list1.begin(), my_list2, first, last);
+  EXPECT_TRUE(compare_lists(my_list1, std::list<int>{1, 30, 40, 2, 3, 20}));
+  EXPECT_TRUE(compare_lists(my_list2, std::list<int>{10, 50}));
+
+  my_list1.splice(my_list1.begin(), my_list1, --my_list1.end());
+  my_list1.splice(my_list1.end(), my_list1, ++my_list1.begin(),
+                  ++++++my_list1.begin());
+  EXPECT_TRUE(compare_lists(my_list1, std::list<int>{20, 40, 2, 3, 1, 30}));
+  EXPECT_EQ(my_list1.size(), 6U);
+  EXPECT_EQ(*--my_list1.end(), 30);
+
+  my_list2.splice(my_list2.end(), my_list1);
+  EXPECT_TRUE(my_list1.empty());
+  EXPECT_EQ(my_list2.size(), 8U);
+  EXPECT_EQ(*++my_list2.begin(), 50);
+}
+
+TEST(ListTest, SpliceAcrossNodePools) {
+  s21::List<std::string> my_list1;
+  my_list1.reserve_nodes(1);
+  my_list1.push_back("a");
+  s21::List<std::string> my_list2;
+  my_list2.reserve_nodes(3);
+  my_list2.insert_many_back("b", "c", "d");
+
+  EXPECT_FALSE(my_list1.can_take_nodes_of(my_list2));
+  EXPECT_THROW(my_list1.splice(my_list1.end(), my_list2),
+               std::invalid_argument);
+  EXPECT_THROW(my_list1.splice(my_list1.end(), my_list2, my_list2.begin()),
+               std::invalid_argument);
+  EXPECT_EQ(my_list2.size(), 3U);
+
+  s21::List<std::string> my_list3;
+  my_list3.share_node_pool(my_list2);
+  my_list3.splice(my_list3.end(), my_list2, my_list2.begin());
+  my_list3.splice(my_list3.end(), my_list2, my_list2.begin(), my_list2.end());
+  EXPECT_TRUE(my_list2.empty());
+  EXPECT_EQ(my_list3.size(), 3U);
+  EXPECT_EQ(my_list3.back(), "d");
+
+  s21::List<std::string> my_list4{"e"};
+  EXPECT_TRUE(my_list1.can_take_nodes_of(my_list4));
+  my_list1.splice(my_list1.end(), my_list4);
+  EXPECT_EQ(my_list1.back(), "e");
+  EXPECT_EQ(my_list1.node_pool()->capacity(), 1U);
+  my_list3.clear();
+  EXPECT_EQ(my_list2.node_pool()->free_nodes(), 3U);
+}
+
 TEST(ListTest, Insert_1) {
   s21::List<int> my_list1{1, 9999, 20000};
   my_list1.insert(my_list1.begin(), 5);
@@ -1398,6 +2592,256 @@ TEST(ListTest, Erase_3) {
   EXPECT_TRUE(compare_lists(my_list1, std_list1));
 }
 
+TEST(ListTest, SentinelLinks) {
+  s21::List<int> my_list1{1, 2, 3};
+  auto it = my_list1.end();
+  EXPECT_EQ(*--it, 3);
+  EXPECT_EQ(*--it, 2);
+  static_assert(std::is_trivially_copyable_v<s21::List<int>::iterator>);
+  static_assert(std::is_trivially_copyable_v<s21::List<int>::const_iterator>);
+  static_assert(sizeof(s21::List<int>::iterator) == sizeof(void*));
+
+  s21::List<int> my_list2(std::move(my_list1));
+  EXPECT_TRUE(my_list1.empty());
+  EXPECT_EQ(my_list1.begin(), my_list1.end());
+  EXPECT_EQ(*--my_list2.end(), 3);
+
+  my_list2.reverse();
+  std::list<int> std_list2{3, 2, 1};
+  EXPECT_TRUE(compare_lists(my_list2, std_list2));
+  EXPECT_EQ(*--my_list2.end(), 1);
+}
+
+TEST(ListTest, LongListTeardown) {
+  const int count = 1 << 20;
+  s21::List<int> my_list1;
+  for (int i = 0; i < count; ++i) {
+    my_list1.push_back(i);
+  }
+  s21::List<int> my_list2(my_list1);
+  my_list2 = s21::List<int>{1};
+  EXPECT_EQ(my_list2.size(), 1U);
+  my_list1.clear();
+  EXPECT_TRUE(my_list1.empty());
+
+  s21::queue<int> q;
+  for (int i = 0; i < count; ++i) {
+    q.push(i);
+  }
+  EXPECT_EQ(q.size(), static_cast<size_t>(count));
+}
+
+TEST(ListTest, SortRelinksStably) {
+  s21::List<int> my_list1;
+  std::list<int> std_list1;
+  unsigned seed = 7;
+  for (int i = 0; i < 1000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    my_list1.push_back(seed % 100);
+    std_list1.push_back(seed % 100);
+  }
+  int* first = &*my_list1.begin();
+  my_list1.sort();
+  std_list1.sort();
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_EQ(*--my_list1.end(), 99);
+
+  int count = 0;
+  for (auto& el : my_list1) {
+    count += &el == first;
+  }
+  EXPECT_EQ(count, 1);
+
+  s21::List<std::pair<int, char>> my_list2{{2, 'a'}, {1, 'b'}, {2, 'c'},
+                                           {1, 'd'}, {0, 'e'}};
+  my_list2.sort([](const auto& a, const auto& b) { return a.first > b.first; });
+  std::string order;
+  for (auto& el : my_list2) {
+    order += el.second;
+  }
+  EXPECT_EQ(order, "acbde");
+}
+
+TEST(ListTest, SortKeepsElementsWhenCompareThrows) {
+  for (int limit : {1, 7, 40, 300}) {
+    s21::List<int> my_list1;
+    std::multiset<int> expected;
+    unsigned seed = 11;
+    for (int i = 0; i < 100; ++i) {
+      seed = seed * 1103515245 + 12345;
+      my_list1.push_back(seed % 50);
+      expected.insert(seed % 50);
+    }
+    int calls = 0;
+    auto comp = [&calls, limit](int a, int b) {
+      if (++calls == limit) {
+        throw std::runtime_error("compare");
+      }
+      return a < b;
+    };
+    EXPECT_THROW(my_list1.sort(comp), std::runtime_error);
+    EXPECT_EQ(my_list1.size(), static_cast<size_t>(std::distance(
+                                   my_list1.begin(), my_list1.end())));
+    EXPECT_EQ(std::multiset<int>(my_list1.begin(), my_list1.end()), expected);
+    size_t backwards = 0;
+    for (auto it = my_list1.end(); it != my_list1.begin(); --it) {
+      ++backwards;
+    }
+    EXPECT_EQ(backwards, my_list1.size());
+  }
+}
+
+TEST(ListTest, NodePoolReuse) {
+  s21::List<std::string> my_list1{"before", "pool"};
+  my_list1.reserve_nodes(100);
+  auto pool = my_list1.node_pool();
+  ASSERT_NE(pool, nullptr);
+  EXPECT_EQ(pool->capacity(), 100U);
+
+  for (int i = 0; i < 100; ++i) {
+    my_list1.push_back(std::to_string(i));
+  }
+  EXPECT_EQ(pool->free_nodes(), 0U);
+  EXPECT_EQ(pool->capacity(), 100U);
+  my_list1.push_front("grown");
+  EXPECT_EQ(pool->capacity(), 200U);
+
+  for (int i = 0; i < 50; ++i) {
+    my_list1.pop_back();
+    my_list1.push_back("again");
+  }
+  EXPECT_EQ(pool->capacity(), 200U);
+  EXPECT_EQ(my_list1.front(), "grown");
+  EXPECT_EQ(*++my_list1.begin(), "before");
+
+  my_list1.clear();
+  EXPECT_EQ(pool->free_nodes(), 200U);
+  my_list1.shrink_nodes();
+  EXPECT_EQ(pool->capacity(), 0U);
+  EXPECT_EQ(pool->free_nodes(), 0U);
+}
+
+TEST(ListTest, NodePoolShared) {
+  s21::List<int> my_list1;
+  my_list1.reserve_nodes(4);
+  s21::List<int> my_list2(my_list1.node_pool());
+  my_list1.insert_many_back(1, 2);
+  my_list2.insert_many_back(3, 4);
+  EXPECT_EQ(my_list1.node_pool()->free_nodes(), 0U);
+
+  s21::List<int> my_list3(std::move(my_list1));
+  EXPECT_EQ(my_list1.node_pool(), nullptr);
+  my_list3.swap(my_list2);
+  EXPECT_EQ(my_list3.back(), 4);
+  EXPECT_EQ(my_list2.back(), 2);
+
+  my_list2.clear();
+  my_list3.pop_front();
+  EXPECT_EQ(my_list3.node_pool()->free_nodes(), 3U);
+  my_list3.shrink_nodes();
+  EXPECT_EQ(my_list3.node_pool()->capacity(), 4U);
+}
+
+TEST(ListTest, CompactRelocatesInOrder) {
+  s21::List<std::string> my_list1;
+  std::list<std::string> std_list1;
+  for (int i = 0; i < 300; ++i) {
+    my_list1.push_back(std::to_string(i));
+    std_list1.push_back(std::to_string(i));
+    if (i % 3 == 0) {
+      my_list1.push_front(std::to_string(-i));
+      std_list1.push_front(std::to_string(-i));
+    }
+  }
+  my_list1.sort();
+  std_list1.sort();
+  my_list1.compact();
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_EQ(*--my_list1.end(), std_list1.back());
+
+  auto pool = my_list1.node_pool();
+  ASSERT_NE(pool, nullptr);
+  EXPECT_EQ(pool->capacity(), my_list1.size());
+  const char* prev = nullptr;
+  for (auto& el : my_list1) {
+    const char* current = reinterpret_cast<const char*>(&el);
+    if (prev) {
+      EXPECT_EQ(current - prev, sizeof(s21::ListNode<std::string>));
+    }
+    prev = current;
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    my_list1.pop_front();
+    my_list1.push_back("tail");
+  }
+  my_list1.compact();
+  EXPECT_EQ(pool->capacity(), my_list1.size());
+  EXPECT_EQ(my_list1.back(), "tail");
+}
+
+TEST(ListTest, CompactWorksInBoundedSlabs) {
+  using pool_type = s21::List<int>::node_pool_type;
+  const size_t count = 2 * pool_type::kMaxSlabNodes + 10;
+  s21::List<int> my_list1;
+  my_list1.reserve_nodes(1);
+  for (size_t i = 0; i < count; ++i) {
+    my_list1.push_front(static_cast<int>(i));
+  }
+  auto pool = my_list1.node_pool();
+  EXPECT_LT(pool->capacity(), count + pool_type::kMaxSlabNodes);
+
+  my_list1.reverse();
+  my_list1.compact();
+  EXPECT_EQ(pool->capacity(), count);
+  EXPECT_EQ(pool->free_nodes(), 0U);
+  int expected = 0;
+  size_t breaks = 0;
+  const char* prev = nullptr;
+  for (auto& el : my_list1) {
+    EXPECT_EQ(el, expected++);
+    const char* current = reinterpret_cast<const char*>(&el);
+    if (prev && current - prev != sizeof(s21::ListNode<int>)) {
+      ++breaks;
+    }
+    prev = current;
+  }
+  EXPECT_EQ(expected, static_cast<int>(count));
+  EXPECT_LE(breaks, 2U);
+}
+
+TEST(ListTest, ReserveNodesAddsBoundedSlabs) {
+  using pool_type = s21::List<int>::node_pool_type;
+  const size_t count = 2 * pool_type::kMaxSlabNodes + 5;
+  s21::List<int> my_list1;
+  my_list1.reserve_nodes(count);
+  auto pool = my_list1.node_pool();
+  EXPECT_EQ(pool->capacity(), count);
+  EXPECT_EQ(pool->free_nodes(), count);
+
+  my_list1.push_back(1);
+  my_list1.shrink_nodes();
+  EXPECT_GT(pool->capacity(), 0U);
+  EXPECT_LE(pool->capacity(), pool_type::kMaxSlabNodes);
+  EXPECT_EQ(pool->free_nodes(), pool->capacity() - 1);
+}
+
+TEST(ListTest, NodePoolBacksQueue) {
+  s21::ArenaResource arena;
+  s21::pmr::queue<int> q(&arena);
+  q.reserve(64);
+  size_t allocations = arena.stats().allocations;
+  for (int i = 0; i < 64; ++i) {
+    q.push(i);
+  }
+  for (int i = 64; i < 10000; ++i) {
+    q.pop();
+    q.push(i);
+  }
+  EXPECT_EQ(arena.stats().allocations, allocations);
+  EXPECT_EQ(q.front(), 10000 - 64);
+}
+
 // // // QUEUE
 
 template <typename value_type>
@@ -1990,6 +3434,472 @@ TEST(MapTest, InsertManyRvalueTest) {
   EXPECT_TRUE(value.empty());
 }
 
+// Allocator
+
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocations{0};
+  size_t deallocations{0};
+  size_t bytes_in_use{0};
+
+ private:
+  void* do_allocate(size_t bytes, size_t align) override {
+    ++allocations;
+    bytes_in_use += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+  void do_deallocate(void* p, size_t bytes, size_t align) override {
+    ++deallocations;
+    bytes_in_use -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(const memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  explicit TaggedAllocator(int t = 0) : tag(t) {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U>& other) : tag(other.tag) {}
+
+  T* allocate(size_t n) { return std::allocator<T>().allocate(n); }
+  void deallocate(T* p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  template <typename U>
+  bool operator==(const TaggedAllocator<U>& other) const {
+    return tag == other.tag;
+  }
+  template <typename U>
+  bool operator!=(const TaggedAllocator<U>& other) const {
+    return tag != other.tag;
+  }
+
+  int tag;
+};
+
+TEST(AllocatorTest, PmrVectorUsesResource) {
+  CountingResource res;
+  {
+    s21::pmr::Vector<int> v(&res);
+    for (int i = 0; i < 100; ++i) {
+      v.push_back(i);
+    }
+    EXPECT_EQ(v.get_allocator().resource(), &res);
+    EXPECT_EQ(v.size(), 100U);
+    EXPECT_EQ(v[99], 99);
+    EXPECT_GT(res.allocations, 0U);
+  }
+  EXPECT_EQ(res.allocations, res.deallocations);
+  EXPECT_EQ(res.bytes_in_use, 0U);
+}
+
+TEST(AllocatorTest, PmrVectorInMonotonicArena) {
+  char buffer[1024];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::Vector<int> v({1, 2, 3, 4}, &arena);
+  v.push_back(5);
+  EXPECT_EQ(v.size(), 5U);
+  EXPECT_GE(reinterpret_cast<char*>(&v[0]), buffer);
+  EXPECT_LT(reinterpret_cast<char*>(&v[0]), buffer + sizeof(buffer));
+}
+
+TEST(AllocatorTest, PmrVectorCopyUsesDefaultResource) {
+  CountingResource res;
+  s21::pmr::Vector<int> v({1, 2, 3}, &res);
+  s21::pmr::Vector<int> copy(v);
+  s21::pmr::Vector<int> extended(v, &res);
+  EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+  EXPECT_EQ(extended.get_allocator().resource(), &res);
+  EXPECT_EQ(copy[2], 3);
+  EXPECT_EQ(extended[2], 3);
+}
+
+TEST(AllocatorTest, PmrVectorMoveBetweenResources) {
+  CountingResource res1;
+  CountingResource res2;
+  s21::pmr::Vector<std::string> v1({"a", "b", "c"}, &res1);
+  s21::pmr::Vector<std::string> v2(&res2);
+  v2 = std::move(v1);
+  EXPECT_EQ(v2.get_allocator().resource(), &res2);
+  EXPECT_EQ(v2.size(), 3U);
+  EXPECT_EQ(v2[1], "b");
+  EXPECT_TRUE(v1.empty());
+  EXPECT_GT(res2.allocations, 0U);
+}
+
+TEST(AllocatorTest, VectorPropagatesAllocator) {
+  using vector = s21::Vector<int, TaggedAllocator<int>>;
+  vector v1({1, 2, 3}, TaggedAllocator<int>(1));
+  vector v2({4, 5}, TaggedAllocator<int>(2));
+
+  vector copy(TaggedAllocator<int>(3));
+  copy = v1;
+  EXPECT_EQ(copy.get_allocator().tag, 1);
+
+  vector moved(TaggedAllocator<int>(4));
+  moved = std::move(v2);
+  EXPECT_EQ(moved.get_allocator().tag, 2);
+  EXPECT_EQ(moved[1], 5);
+
+  copy.swap(moved);
+  EXPECT_EQ(copy.get_allocator().tag, 2);
+  EXPECT_EQ(moved.get_allocator().tag, 1);
+  EXPECT_EQ(copy.size(), 2U);
+  EXPECT_EQ(moved.size(), 3U);
+}
+
+TEST(AllocatorTest, PmrListUsesResource) {
+  CountingResource res;
+  {
+    s21::pmr::List<int> list({1, 2, 3}, &res);
+    list.push_front(0);
+    EXPECT_EQ(list.get_allocator().resource(), &res);
+    EXPECT_EQ(res.allocations, 4U);
+
+    s21::pmr::List<int> copy(list, &res);
+    EXPECT_EQ(copy.size(), 4U);
+    EXPECT_EQ(copy.front(), 0);
+    EXPECT_EQ(res.allocations, 8U);
+  }
+  EXPECT_EQ(res.bytes_in_use, 0U);
+}
+
+TEST(AllocatorTest, ListPropagatesAllocator) {
+  using list = s21::List<int, TaggedAllocator<int>>;
+  list l1({1, 2, 3}, TaggedAllocator<int>(1));
+  list l2(TaggedAllocator<int>(2));
+  l2 = l1;
+  EXPECT_EQ(l2.get_allocator().tag, 1);
+  EXPECT_EQ(l2.size(), 3U);
+
+  list l3(TaggedAllocator<int>(3));
+  l3 = std::move(l1);
+  EXPECT_EQ(l3.get_allocator().tag, 1);
+  EXPECT_TRUE(l1.empty());
+  EXPECT_EQ(l3.back(), 3);
+}
+
+TEST(AllocatorTest, PmrMapUsesResource) {
+  CountingResource res;
+  {
+    s21::pmr::Map<int, int> map(&res);
+    map.insert(1, 10);
+    map.insert(2, 20);
+    EXPECT_EQ(map.at(2), 20);
+    EXPECT_GT(res.allocations, 2U);
+  }
+  EXPECT_EQ(res.bytes_in_use, 0U);
+}
+
+TEST(AllocatorTest, PmrSetAndMultisetUseResource) {
+  CountingResource res;
+  {
+    s21::pmr::Set<int> set({1, 2, 3}, &res);
+    s21::pmr::Multiset<int> multiset({4, 5}, &res);
+    EXPECT_TRUE(set.contains(2));
+    EXPECT_TRUE(multiset.contains(5));
+    EXPECT_EQ(set.get_allocator().resource(), &res);
+    EXPECT_EQ(multiset.get_allocator().resource(), &res);
+  }
+  EXPECT_EQ(res.bytes_in_use, 0U);
+}
+
+TEST(AllocatorTest, PmrAdaptersUseResource) {
+  CountingResource res;
+  {
+    s21::pmr::stack<int> stack(&res);
+    s21::pmr::queue<int> queue(&res);
+    stack.push(1);
+    queue.push(2);
+    EXPECT_EQ(stack.top(), 1);
+    EXPECT_EQ(queue.front(), 2);
+    EXPECT_EQ(res.allocations, 2U);
+  }
+  EXPECT_EQ(res.bytes_in_use, 0U);
+}
+
+TEST(AllocatorTest, VectorRangeSingleAllocation) {
+  CountingResource res;
+  std::vector<int> src(1000, 3);
+  s21::pmr::Vector<int> v(&res);
+  v.push_back(1);
+  size_t before = res.allocations;
+  v.append(src.begin(), src.end());
+  EXPECT_EQ(res.allocations, before + 1);
+  v.insert(v.begin(), src.begin(), src.end());
+  EXPECT_EQ(res.allocations, before + 2);
+  v.insert_many_back(1, 2, 3, 4, 5, 6, 7, 8, 9);
+  EXPECT_EQ(res.allocations, before + 3);
+  EXPECT_EQ(v.size(), 2010U);
+  EXPECT_EQ(v[1000], 1);
+}
+
+TEST(AllocatorTest, SmallVectorAvoidsHeap) {
+  CountingResource res;
+  {
+    s21::pmr::SmallVector<int, 8> v(&res);
+    for (int i = 0; i < 8; ++i) v.push_back(i);
+    EXPECT_EQ(res.allocations, 0U);
+    v.push_back(8);
+    EXPECT_EQ(res.allocations, 1U);
+  }
+  EXPECT_EQ(res.bytes_in_use, 0U);
+}
+
+TEST(AllocatorTest, SmallVectorPropagatesOnMove) {
+  using small = s21::SmallVector<int, 4, TaggedAllocator<int>>;
+  small heap({1, 2, 3, 4, 5, 6}, TaggedAllocator<int>(1));
+  small inline_items({7, 8}, TaggedAllocator<int>(2));
+  heap = std::move(inline_items);
+  EXPECT_EQ(heap.get_allocator().tag, 2);
+  EXPECT_TRUE(heap.is_inline());
+  EXPECT_EQ(heap.capacity(), 4U);
+  EXPECT_EQ(heap.size(), 2U);
+  EXPECT_EQ(heap[1], 8);
+}
+
+TEST(AllocatorTest, AlignedVector) {
+  s21::AlignedVector<float> v;
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(static_cast<float>(i));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data()) % 64, 0U);
+  }
+  s21::AlignedVector<double, 32> w(v.size(), 1.0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(w.data()) % 32, 0U);
+  w.shrink_to_fit();
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(w.data()) % 32, 0U);
+  EXPECT_EQ(s21::simd::accumulate(w), 1000.0);
+  EXPECT_EQ(s21::AlignedAllocator<float>::padded_bytes(1), 64U);
+  EXPECT_EQ(s21::AlignedAllocator<float>::padded_bytes(17), 128U);
+}
+
+// Memory resources
+
+TEST(MemoryResourceTest, ArenaBumpAllocates) {
+  CountingResource upstream;
+  s21::ArenaResource arena(256, &upstream);
+  void* a = arena.allocate(16, 8);
+  void* b = arena.allocate(16, 8);
+  EXPECT_EQ(static_cast<char*>(b) - static_cast<char*>(a), 16);
+  EXPECT_EQ(arena.stats().allocations, 2U);
+  EXPECT_EQ(arena.stats().bytes_in_use, 32U);
+  EXPECT_EQ(upstream.allocations, 1U);
+
+  arena.deallocate(a, 16, 8);
+  EXPECT_EQ(arena.stats().deallocations, 1U);
+  EXPECT_EQ(arena.stats().bytes_in_use, 32U);
+}
+
+TEST(MemoryResourceTest, ArenaRespectsAlignment) {
+  s21::ArenaResource arena;
+  EXPECT_NE(arena.allocate(1, 1), nullptr);
+  void* p = arena.allocate(64, 64);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 64, 0U);
+}
+
+TEST(MemoryResourceTest, ArenaResetReusesLargestChunk) {
+  CountingResource upstream;
+  s21::ArenaResource arena(128, &upstream);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_NE(arena.allocate(32, 8), nullptr);
+  }
+  size_t chunks = upstream.allocations;
+  EXPECT_GT(chunks, 1U);
+
+  arena.reset();
+  EXPECT_EQ(upstream.deallocations, chunks - 1);
+  EXPECT_EQ(arena.stats().bytes_in_use, 0U);
+  EXPECT_EQ(arena.stats().upstream_bytes, upstream.bytes_in_use);
+
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_NE(arena.allocate(32, 8), nullptr);
+  }
+  EXPECT_EQ(upstream.allocations, chunks);
+
+  arena.release();
+  EXPECT_EQ(upstream.bytes_in_use, 0U);
+  EXPECT_EQ(arena.stats().upstream_bytes, 0U);
+}
+
+TEST(MemoryResourceTest, ArenaUsesInitialBuffer) {
+  char buffer[256];
+  s21::ArenaResource arena(buffer, sizeof(buffer),
+                           std::pmr::null_memory_resource());
+  void* p = arena.allocate(100, 8);
+  EXPECT_GE(static_cast<char*>(p), buffer);
+  EXPECT_LT(static_cast<char*>(p), buffer + sizeof(buffer));
+  EXPECT_THROW((void)arena.allocate(1024, 8), std::bad_alloc);
+  arena.reset();
+  EXPECT_EQ(arena.remaining(), sizeof(buffer));
+}
+
+TEST(MemoryResourceTest, ArenaBacksRequestScopedContainers) {
+  CountingResource upstream;
+  s21::ArenaResource arena(1024, &upstream);
+  for (int request = 0; request < 3; ++request) {
+    {
+      s21::pmr::List<int> list({1, 2, 3}, &arena);
+      s21::pmr::Map<int, int> map(&arena);
+      map.insert(1, 2);
+      s21::pmr::Vector<int> v({4, 5, 6}, &arena);
+      EXPECT_EQ(list.back(), 3);
+      EXPECT_EQ(map.at(1), 2);
+      EXPECT_EQ(v[2], 6);
+    }
+    arena.reset();
+  }
+  EXPECT_EQ(upstream.allocations - upstream.deallocations, 1U);
+}
+
+TEST(MemoryResourceTest, NodePoolRecyclesBlocks) {
+  CountingResource upstream;
+  s21::NodePoolResource pool(32, 4, &upstream);
+  void* a = pool.allocate(32, 8);
+  void* b = pool.allocate(24, 8);
+  EXPECT_NE(a, b);
+  pool.deallocate(a, 32, 8);
+  void* c = pool.allocate(32, 8);
+  EXPECT_EQ(a, c);
+  EXPECT_EQ(pool.stats().reused_blocks, 1U);
+  EXPECT_EQ(pool.stats().bytes_in_use, 64U);
+  EXPECT_EQ(upstream.allocations, 1U);
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NE(pool.allocate(32, 8), nullptr);
+  }
+  EXPECT_EQ(upstream.allocations, 2U);
+}
+
+TEST(MemoryResourceTest, NodePoolForwardsOversizedRequests) {
+  CountingResource upstream;
+  s21::NodePoolResource pool(16, 8, &upstream);
+  void* p = pool.allocate(100, 8);
+  EXPECT_EQ(upstream.allocations, 1U);
+  EXPECT_EQ(pool.free_blocks(), 0U);
+  pool.deallocate(p, 100, 8);
+  EXPECT_EQ(upstream.deallocations, 1U);
+}
+
+TEST(MemoryResourceTest, NodePoolReserve) {
+  CountingResource upstream;
+  s21::NodePoolResource pool(16, 8, &upstream);
+  pool.reserve(100);
+  EXPECT_GE(pool.free_blocks(), 100U);
+  EXPECT_EQ(upstream.allocations, 1U);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_NE(pool.allocate(16, 8), nullptr);
+  }
+  EXPECT_EQ(upstream.allocations, 1U);
+  pool.release();
+  EXPECT_EQ(upstream.bytes_in_use, 0U);
+}
+
+TEST(MemoryResourceTest, NodePoolServesListNodes) {
+  CountingResource upstream;
+  s21::NodePoolResource pool(s21::list_node_block_size<int>, 64, &upstream);
+  {
+    s21::pmr::List<int> list(&pool);
+    for (int i = 0; i < 1000; ++i) {
+      list.push_back(i);
+      list.pop_front();
+    }
+    EXPECT_TRUE(list.empty());
+  }
+  EXPECT_EQ(upstream.allocations, 1U);
+  EXPECT_GE(pool.stats().reused_blocks, 998U);
+}
+
+TEST(MemoryResourceTest, NodePoolServesHashEntries) {
+  CountingResource upstream;
+  s21::NodePoolResource pool(s21::hash_node_block_size<int, int>, 64,
+                             &upstream);
+  s21::pmr::Map<int, int> map(&pool);
+  size_t before = upstream.allocations;
+  for (int i = 0; i < 20; ++i) {
+    map.insert(i, i);
+  }
+  EXPECT_EQ(map.size(), 20U);
+  EXPECT_LE(upstream.allocations - before, 1U);
+}
+
+TEST(MemoryResourceTest, ThreadCachingReusesBlocks) {
+  CountingResource upstream;
+  s21::ThreadCachingResource cache(8, &upstream);
+  void* a = cache.allocate(24, 8);
+  cache.deallocate(a, 24, 8);
+  void* b = cache.allocate(20, 8);
+  EXPECT_EQ(a, b);
+  cache.deallocate(b, 20, 8);
+
+  s21::ResourceStats stats = cache.stats();
+  EXPECT_EQ(stats.allocations, 2U);
+  EXPECT_EQ(stats.deallocations, 2U);
+  EXPECT_EQ(stats.bytes_in_use, 0U);
+  EXPECT_EQ(stats.peak_bytes_in_use, 32U);
+  EXPECT_EQ(stats.reused_blocks, 1U);
+  EXPECT_EQ(stats.upstream_allocations, 1U);
+}
+
+TEST(MemoryResourceTest, ThreadCachingForwardsLargeRequests) {
+  CountingResource upstream;
+  s21::ThreadCachingResource cache(8, &upstream);
+  void* p = cache.allocate(4096, 8);
+  EXPECT_EQ(upstream.allocations, 1U);
+  cache.deallocate(p, 4096, 8);
+  EXPECT_EQ(upstream.deallocations, 1U);
+}
+
+TEST(MemoryResourceTest, ThreadCachingOutlivesManyResources) {
+  CountingResource upstream;
+  s21::ThreadCachingResource keeper(8, &upstream);
+  for (int round = 0; round < 100; ++round) {
+    s21::ThreadCachingResource scratch(8, &upstream);
+    void* a = scratch.allocate(32, 8);
+    void* b = keeper.allocate(32, 8);
+    scratch.deallocate(a, 32, 8);
+    keeper.deallocate(b, 32, 8);
+  }
+  EXPECT_EQ(keeper.stats().bytes_in_use, 0U);
+  EXPECT_EQ(keeper.stats().upstream_allocations, 1U);
+  EXPECT_EQ(keeper.stats().reused_blocks, 99U);
+}
+
+TEST(MemoryResourceTest, ThreadCachingAcrossThreads) {
+  s21::ThreadCachingResource cache;
+  auto work = [&cache]() {
+    for (int round = 0; round < 50; ++round) {
+      s21::pmr::List<int> list(&cache);
+      for (int i = 0; i < 200; ++i) {
+        list.push_back(i);
+      }
+      int sum = 0;
+      for (int value : list) {
+        sum += value;
+      }
+      EXPECT_EQ(sum, 199 * 100);
+    }
+  };
+  std::thread t1(work);
+  std::thread t2(work);
+  work();
+  t1.join();
+  t2.join();
+
+  s21::ResourceStats stats = cache.stats();
+  EXPECT_EQ(stats.allocations, 3U * 50 * 200);
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.bytes_in_use, 0U);
+  EXPECT_GT(stats.reused_blocks, 0U);
+}
+
 int main(int argc, char* argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
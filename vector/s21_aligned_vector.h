@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../memory/s21_aligned_allocator.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Vector whose data() is aligned to Align bytes, 64 by default: a cache line
+// and a whole AVX-512 register. At that alignment two AlignedVectors never
+// share a cache line, so vectors handed to different threads do not suffer
+// from false sharing.
+template <typename T, size_t Align = 64>
+using AlignedVector = Vector<T, AlignedAllocator<T, Align>>;
+
+}  // namespace s21
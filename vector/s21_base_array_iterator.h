@@ -1,6 +1,9 @@
 #pragma once
 
-#include <memory>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
 
 namespace s21 {
 
@@ -14,27 +17,14 @@ class BaseArrayIterator {
   using iterator_category = std::random_access_iterator_tag;
 
   BaseArrayIterator() = default;
-  BaseArrayIterator(std::shared_ptr<value_type[]> ptr, size_t size)
-      : ptr_(ptr), size_(size){};
+  BaseArrayIterator(pointer ptr, size_t size) : ptr_(ptr), size_(size){};
   virtual ~BaseArrayIterator() = default;
 
-  reference operator*() const noexcept {
-    return *(this->get_shared().get() + this->index_);
-  }
+  reference operator*() const noexcept { return *(ptr_ + index_); }
 
-  pointer operator->() const noexcept {
-    return this->get_shared().get() + this->index_;
-  }
+  pointer operator->() const noexcept { return ptr_ + index_; }
 
  protected:
-  std::shared_ptr<value_type[]> get_shared() const {
-    try {
-      return ptr_.lock();
-    } catch (std::bad_weak_ptr &e) {
-      throw std::runtime_error(
-          "Error: Attempted to access an expired weak pointer");
-    }
-  }
   void forward(int step = 1) {
     if (index_ + step > size_) {
       throw std::out_of_range("Error: Step goes beyond vector size");
@@ -49,7 +39,7 @@ class BaseArrayIterator {
   }
 
  protected:
-  std::weak_ptr<value_type[]> ptr_;
+  pointer ptr_{nullptr};
   size_t index_{0};
   size_t size_{0};
 };
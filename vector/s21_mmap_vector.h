@@ -0,0 +1,519 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "s21_vector_iterator.h"
+
+namespace s21 {
+
+// How MmapVector opens its file. kReadOnly maps an existing file without
+// copying it and rejects every modification, including non-const element
+// access, so it is read through a const reference; kReadWrite opens the
+// file or creates it and keeps its contents; kTruncate starts from an empty
+// file.
+enum class MmapMode { kReadOnly, kReadWrite, kTruncate };
+
+// Access pattern hints forwarded to madvise.
+enum class MmapAdvice { kNormal, kSequential, kRandom, kWillNeed, kDontNeed };
+
+// Vector of trivially copyable T stored in a memory-mapped file. The file is
+// a plain array of T with no header, so an existing binary dump can be
+// opened as is and is paged in on demand rather than parsed.
+//
+// While open for writing the file is grown ahead of size() the same way a
+// Vector grows its capacity; close() and the destructor trim it back to
+// exactly size() elements. Growing the mapping may move it, which
+// invalidates pointers, references and iterators just like a Vector
+// reallocation. System call failures are reported as std::runtime_error.
+template <typename T>
+class MmapVector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "MmapVector requires a trivially copyable type");
+
+  template <typename It>
+  using if_input_iterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::input_iterator_tag>>;
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = VectorIterator<T>;
+  using const_iterator = ConstVectorIterator<T>;
+  using size_type = size_t;
+
+  MmapVector() noexcept = default;
+  explicit MmapVector(const std::string& path,
+                      MmapMode mode = MmapMode::kReadWrite);
+  MmapVector(const MmapVector&) = delete;
+  MmapVector(MmapVector&& other) noexcept;
+  ~MmapVector();
+
+  MmapVector& operator=(const MmapVector&) = delete;
+  MmapVector& operator=(MmapVector&& other) noexcept;
+
+  void open(const std::string& path, MmapMode mode = MmapMode::kReadWrite);
+  void close();
+  bool is_open() const noexcept { return fd_ != -1; }
+  bool read_only() const noexcept { return read_only_; }
+  void advise(MmapAdvice advice);
+  void sync();
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) { return at(pos); }
+  const_reference operator[](size_type pos) const { return at(pos); }
+  const_reference front() const { return at(0); }
+  const_reference back() const { return at(size_ - 1); }
+  pointer data();
+  const_pointer data() const noexcept { return data_; }
+
+  iterator begin();
+  iterator end() { return begin() + size_; }
+  const_iterator begin() const { return const_iterator(data_, size_); }
+  const_iterator end() const { return begin() + size_; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  void shrink_to_fit();
+  void resize(size_type count, const_reference value = {});
+
+  void push_back(const_reference value) { emplace_back(value); }
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+  template <typename InputIt, typename = if_input_iterator<InputIt>>
+  void append(InputIt first, InputIt last);
+  void append(std::initializer_list<T> items);
+  void pop_back();
+  void clear();
+
+ private:
+  void check_writable() const;
+  void check_not_read_only() const;
+  size_type grown_capacity(size_type count) const;
+  template <typename It>
+  bool may_alias(It first) const noexcept;
+  void remap(size_type new_cap);
+  void unmap() noexcept;
+  void apply_advice() noexcept;
+  void reset() noexcept;
+  [[noreturn]] static void fail(const char* what);
+
+  pointer data_{nullptr};
+  size_type size_{0};
+  size_type capacity_{0};
+  int fd_{-1};
+  bool read_only_{false};
+  MmapAdvice advice_{MmapAdvice::kNormal};
+};
+
+template <typename T>
+MmapVector<T>::MmapVector(const std::string& path, MmapMode mode) {
+  open(path, mode);
+}
+
+template <typename T>
+MmapVector<T>::MmapVector(MmapVector&& other) noexcept
+    : data_(other.data_),
+      size_(other.size_),
+      capacity_(other.capacity_),
+      fd_(other.fd_),
+      read_only_(other.read_only_),
+      advice_(other.advice_) {
+  other.reset();
+}
+
+// Errors cannot escape a destructor; call close() first to observe them.
+template <typename T>
+MmapVector<T>::~MmapVector() {
+  try {
+    close();
+  } catch (...) {
+  }
+}
+
+template <typename T>
+MmapVector<T>& MmapVector<T>::operator=(MmapVector&& other) noexcept {
+  if (this != &other) {
+    try {
+      close();
+    } catch (...) {
+    }
+    data_ = other.data_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    fd_ = other.fd_;
+    read_only_ = other.read_only_;
+    advice_ = other.advice_;
+    other.reset();
+  }
+  return *this;
+}
+
+template <typename T>
+void MmapVector<T>::open(const std::string& path, MmapMode mode) {
+  close();
+  read_only_ = mode == MmapMode::kReadOnly;
+  int flags = read_only_ ? O_RDONLY : O_RDWR | O_CREAT;
+  if (mode == MmapMode::kTruncate) {
+    flags |= O_TRUNC;
+  }
+  fd_ = ::open(path.c_str(), flags, 0644);
+  if (fd_ == -1) {
+    reset();
+    fail("Failed to open file");
+  }
+
+  struct stat st;
+  if (::fstat(fd_, &st) == -1) {
+    int err = errno;
+    ::close(fd_);
+    reset();
+    errno = err;
+    fail("Failed to stat file");
+  }
+  size_type count = static_cast<size_type>(st.st_size) / sizeof(T);
+  try {
+    remap(count);
+  } catch (...) {
+    ::close(fd_);
+    reset();
+    throw;
+  }
+  size_ = count;
+}
+
+// Unmaps the file and trims it to exactly size() elements.
+template <typename T>
+void MmapVector<T>::close() {
+  if (!is_open()) {
+    return;
+  }
+  int fd = fd_;
+  bool trim = !read_only_;
+  off_t length = static_cast<off_t>(size_ * sizeof(T));
+  unmap();
+  reset();
+  if (trim && ::ftruncate(fd, length) == -1) {
+    int err = errno;
+    ::close(fd);
+    errno = err;
+    fail("Failed to truncate file");
+  }
+  if (::close(fd) == -1) {
+    fail("Failed to close file");
+  }
+}
+
+template <typename T>
+void MmapVector<T>::advise(MmapAdvice advice) {
+  advice_ = advice;
+  apply_advice();
+}
+
+// Flushes modified pages to the file.
+template <typename T>
+void MmapVector<T>::sync() {
+  if (data_ && !read_only_ &&
+      ::msync(data_, capacity_ * sizeof(T), MS_SYNC) == -1) {
+    fail("Failed to sync mapping");
+  }
+}
+
+template <typename T>
+typename MmapVector<T>::reference MmapVector<T>::at(size_type pos) {
+  check_not_read_only();
+  if (pos >= size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the vector");
+  }
+  return data_[pos];
+}
+
+template <typename T>
+typename MmapVector<T>::const_reference MmapVector<T>::at(
+    size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the vector");
+  }
+  return data_[pos];
+}
+
+template <typename T>
+typename MmapVector<T>::pointer MmapVector<T>::data() {
+  check_not_read_only();
+  return data_;
+}
+
+template <typename T>
+typename MmapVector<T>::iterator MmapVector<T>::begin() {
+  check_not_read_only();
+  return iterator(data_, size_);
+}
+
+template <typename T>
+typename MmapVector<T>::size_type MmapVector<T>::max_size() const noexcept {
+  return static_cast<size_type>(std::numeric_limits<off_t>::max()) /
+         sizeof(T);
+}
+
+template <typename T>
+void MmapVector<T>::reserve(size_type new_cap) {
+  check_writable();
+  if (new_cap > max_size()) {
+    throw std::length_error("Error: Requested size exceeds max_size");
+  }
+  if (new_cap > capacity_) {
+    remap(new_cap);
+  }
+}
+
+template <typename T>
+void MmapVector<T>::shrink_to_fit() {
+  check_writable();
+  if (capacity_ != size_) {
+    remap(size_);
+  }
+}
+
+template <typename T>
+void MmapVector<T>::resize(size_type count, const_reference value) {
+  check_writable();
+  if (count > max_size()) {
+    throw std::length_error("Error: Requested size exceeds max_size");
+  }
+  if (count > size_) {
+    T tmp = value;
+    if (count > capacity_) {
+      remap(std::max(count, grown_capacity(1)));
+    }
+    std::fill(data_ + size_, data_ + count, tmp);
+  }
+  size_ = count;
+}
+
+template <typename T>
+template <typename... Args>
+typename MmapVector<T>::reference MmapVector<T>::emplace_back(
+    Args&&... args) {
+  check_writable();
+  // Built before growing: args may refer to an element of the old mapping.
+  T tmp(std::forward<Args>(args)...);
+  if (size_ == capacity_) {
+    remap(grown_capacity(1));
+  }
+  data_[size_] = tmp;
+  return data_[size_++];
+}
+
+template <typename T>
+template <typename... Args>
+void MmapVector<T>::insert_many_back(Args&&... args) {
+  append({T(std::forward<Args>(args))...});
+}
+
+template <typename T>
+template <typename InputIt, typename>
+void MmapVector<T>::append(InputIt first, InputIt last) {
+  check_writable();
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_convertible_v<category, std::forward_iterator_tag>) {
+    size_type count = std::distance(first, last);
+    if (count > capacity_ - size_) {
+      // Growing may move the mapping, so a range read from it is copied out
+      // first.
+      if (may_alias(first)) {
+        Vector<T> staged;
+        staged.append(first, last);
+        append(staged.data(), staged.data() + count);
+        return;
+      }
+      remap(grown_capacity(count));
+    }
+    std::copy(first, last, data_ + size_);
+    size_ += count;
+  } else {
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+}
+
+template <typename T>
+void MmapVector<T>::append(std::initializer_list<T> items) {
+  append(items.begin(), items.end());
+}
+
+template <typename T>
+void MmapVector<T>::pop_back() {
+  check_writable();
+  if (size_ > 0) {
+    --size_;
+  }
+}
+
+template <typename T>
+void MmapVector<T>::clear() {
+  check_writable();
+  size_ = 0;
+}
+
+template <typename T>
+void MmapVector<T>::check_writable() const {
+  if (!is_open()) {
+    throw std::runtime_error("Error: MmapVector is not open");
+  }
+  check_not_read_only();
+}
+
+// The pages of a read-only mapping are PROT_READ: handing out a mutable
+// reference into them would turn a stray write into SIGSEGV.
+template <typename T>
+void MmapVector<T>::check_not_read_only() const {
+  if (read_only_) {
+    throw std::runtime_error("Error: MmapVector is read-only");
+  }
+}
+
+template <typename T>
+typename MmapVector<T>::size_type MmapVector<T>::grown_capacity(
+    size_type count) const {
+  if (count > max_size() - size_) {
+    throw std::length_error("Error: Requested size exceeds max_size");
+  }
+  return std::max(std::min(capacity_ * 2, max_size()), size_ + count);
+}
+
+// Whether the range starting at first may read elements of the mapping.
+// Iterators that do not yield references may compute from anything, so
+// they are assumed to.
+template <typename T>
+template <typename It>
+bool MmapVector<T>::may_alias(It first) const noexcept {
+  using ref = typename std::iterator_traits<It>::reference;
+  if constexpr (std::is_lvalue_reference_v<ref>) {
+    const void* element = std::addressof(*first);
+    std::less<const void*> less;
+    return !less(element, data_) && less(element, data_ + size_);
+  } else {
+    return true;
+  }
+}
+
+// Resizes the file to new_cap elements and maps all of it. On Linux the
+// existing mapping is extended with mremap, which can avoid copying page
+// tables; elsewhere it is dropped and mapped again.
+template <typename T>
+void MmapVector<T>::remap(size_type new_cap) {
+  size_t old_bytes = capacity_ * sizeof(T);
+  size_t new_bytes = new_cap * sizeof(T);
+  if (!read_only_ &&
+      ::ftruncate(fd_, static_cast<off_t>(new_bytes)) == -1) {
+    fail("Failed to resize file");
+  }
+  void* mapped = nullptr;
+#ifdef __linux__
+  if (data_ && new_bytes) {
+    mapped = ::mremap(data_, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (mapped == MAP_FAILED) {
+      fail("Failed to remap file");
+    }
+  }
+#else
+  (void)old_bytes;
+#endif
+  if (!mapped) {
+    unmap();
+    if (new_bytes) {
+      int prot = read_only_ ? PROT_READ : PROT_READ | PROT_WRITE;
+      mapped = ::mmap(nullptr, new_bytes, prot, MAP_SHARED, fd_, 0);
+      if (mapped == MAP_FAILED) {
+        fail("Failed to map file");
+      }
+    }
+  }
+  data_ = static_cast<pointer>(mapped);
+  capacity_ = new_cap;
+  apply_advice();
+}
+
+template <typename T>
+void MmapVector<T>::unmap() noexcept {
+  if (data_) {
+    ::munmap(data_, capacity_ * sizeof(T));
+    data_ = nullptr;
+    capacity_ = 0;
+  }
+}
+
+// A failed hint is not an error worth surfacing; the kernel just keeps its
+// default readahead.
+template <typename T>
+void MmapVector<T>::apply_advice() noexcept {
+  if (!data_) {
+    return;
+  }
+  int flag = MADV_NORMAL;
+  switch (advice_) {
+    case MmapAdvice::kNormal:
+      flag = MADV_NORMAL;
+      break;
+    case MmapAdvice::kSequential:
+      flag = MADV_SEQUENTIAL;
+      break;
+    case MmapAdvice::kRandom:
+      flag = MADV_RANDOM;
+      break;
+    case MmapAdvice::kWillNeed:
+      flag = MADV_WILLNEED;
+      break;
+    case MmapAdvice::kDontNeed:
+      flag = MADV_DONTNEED;
+      break;
+  }
+  ::madvise(data_, capacity_ * sizeof(T), flag);
+}
+
+template <typename T>
+void MmapVector<T>::reset() noexcept {
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+  fd_ = -1;
+  read_only_ = false;
+  advice_ = MmapAdvice::kNormal;
+}
+
+template <typename T>
+void MmapVector<T>::fail(const char* what) {
+  throw std::runtime_error(std::string("Error: ") + what + ": " +
+                           std::strerror(errno));
+}
+
+}  // namespace s21
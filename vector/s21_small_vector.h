@@ -0,0 +1,382 @@
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Allocator of the Vector under a SmallVector. It forwards everything to
+// Allocator, except that it never frees the inline buffer it was given, so
+// the Vector can hold that buffer like any other allocation. The buffer
+// belongs to one object: the allocator never propagates and only compares
+// equal to itself.
+template <typename T, typename Allocator>
+class InlineBufferAllocator {
+  using traits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  InlineBufferAllocator(const Allocator& upstream, T* buffer) noexcept
+      : upstream_(upstream), buffer_(buffer) {}
+
+  T* allocate(size_type count) { return traits::allocate(upstream_, count); }
+  void deallocate(T* ptr, size_type count) noexcept {
+    if (ptr != buffer_) {
+      traits::deallocate(upstream_, ptr, count);
+    }
+  }
+  template <typename... Args>
+  void construct(T* ptr, Args&&... args) {
+    traits::construct(upstream_, ptr, std::forward<Args>(args)...);
+  }
+  void destroy(T* ptr) noexcept { traits::destroy(upstream_, ptr); }
+  size_type max_size() const noexcept { return traits::max_size(upstream_); }
+
+  const Allocator& upstream() const noexcept { return upstream_; }
+
+  friend bool operator==(const InlineBufferAllocator& lhs,
+                         const InlineBufferAllocator& rhs) noexcept {
+    return lhs.buffer_ == rhs.buffer_ && lhs.upstream_ == rhs.upstream_;
+  }
+  friend bool operator!=(const InlineBufferAllocator& lhs,
+                         const InlineBufferAllocator& rhs) noexcept {
+    return !(lhs == rhs);
+  }
+
+ private:
+  Allocator upstream_;
+  T* buffer_;
+};
+
+// Vector with room for N elements inside the object itself. The heap is only
+// touched once the size grows past N; shrink_to_fit brings the elements back
+// inline when they fit again.
+//
+// SmallVector has the API and iterators of Vector but is not a Vector, so
+// Vector itself carries no inline-buffer state and its moves never copy
+// elements. Converting between the two hands over the heap buffer when
+// there is one and moves the elements one by one otherwise.
+template <typename T, size_t N, typename Allocator = std::allocator<T>>
+class SmallVector : private Vector<T, InlineBufferAllocator<T, Allocator>> {
+  using base = Vector<T, InlineBufferAllocator<T, Allocator>>;
+  using heap_vector = Vector<T, Allocator>;
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using buffer_allocator = InlineBufferAllocator<T, Allocator>;
+
+  static_assert(N > 0, "SmallVector needs a non-empty inline buffer");
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T*>,
+                "SmallVector requires an allocator with raw pointers");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using typename base::const_iterator;
+  using typename base::const_pointer;
+  using typename base::const_reference;
+  using typename base::iterator;
+  using typename base::pointer;
+  using typename base::reference;
+  using typename base::size_type;
+
+  static constexpr size_type inline_capacity = N;
+
+  SmallVector() : SmallVector(Allocator()) {}
+  explicit SmallVector(const Allocator& alloc) noexcept;
+  explicit SmallVector(size_type count, const_reference value = {},
+                       const Allocator& alloc = Allocator());
+  SmallVector(size_type count, default_init_t,
+              const Allocator& alloc = Allocator());
+  SmallVector(std::initializer_list<T> const& items,
+              const Allocator& alloc = Allocator());
+  SmallVector(const SmallVector& v);
+  SmallVector(SmallVector&& v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  SmallVector(const heap_vector& v);
+  SmallVector(heap_vector&& v);
+  ~SmallVector() = default;
+
+  SmallVector& operator=(const SmallVector& v);
+  SmallVector& operator=(SmallVector&& v);
+  operator heap_vector() const&;
+  operator heap_vector() &&;
+
+  using base::operator[];
+  using base::at;
+  using base::back;
+  using base::data;
+  using base::front;
+
+  using base::begin;
+  using base::cbegin;
+  using base::cend;
+  using base::end;
+
+  using base::capacity;
+  using base::empty;
+  using base::max_size;
+  using base::reserve;
+  using base::resize;
+  using base::resize_for_overwrite;
+  using base::size;
+
+  using base::append;
+  using base::assign;
+  using base::clear;
+  using base::emplace;
+  using base::emplace_back;
+  using base::erase;
+  using base::insert;
+  using base::insert_many;
+  using base::insert_many_back;
+  using base::pop_back;
+  using base::push_back;
+  using base::set_element;
+  using base::unstable_erase;
+
+  allocator_type get_allocator() const noexcept {
+    return this->alloc_.upstream();
+  }
+  bool is_inline() const noexcept { return this->data_ == inline_data(); }
+  void shrink_to_fit();
+  void swap(SmallVector& other);
+  void swap(heap_vector& other);
+
+ private:
+  pointer inline_data() const noexcept {
+    return reinterpret_cast<T*>(const_cast<unsigned char*>(storage_));
+  }
+  void reset_storage() noexcept;
+  template <typename Vec>
+  void adopt(Vec& v) noexcept;
+  void take(SmallVector& v);
+  void take(heap_vector& v);
+
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+};
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(const A& alloc) noexcept
+    : base(buffer_allocator(alloc, inline_data())) {
+  reset_storage();
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(size_type count, const_reference value,
+                                  const A& alloc)
+    : SmallVector(alloc) {
+  this->resize(count, value);
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(size_type count, default_init_t,
+                                  const A& alloc)
+    : SmallVector(alloc) {
+  this->resize_for_overwrite(count);
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(std::initializer_list<T> const& items,
+                                  const A& alloc)
+    : SmallVector(alloc) {
+  this->append(items.begin(), items.end());
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(const SmallVector& v)
+    : SmallVector(alloc_traits::select_on_container_copy_construction(
+          v.get_allocator())) {
+  this->append(v.begin(), v.end());
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(SmallVector&& v) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : SmallVector(v.get_allocator()) {
+  take(v);
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(const heap_vector& v)
+    : SmallVector(
+          alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  this->append(v.begin(), v.end());
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(heap_vector&& v) : SmallVector(v.alloc_) {
+  take(v);
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>& SmallVector<T, N, A>::operator=(const SmallVector& v) {
+  if (this == &v) {
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+    if (get_allocator() != v.get_allocator()) {
+      this->release();
+    }
+    this->alloc_ = buffer_allocator(v.get_allocator(), inline_data());
+    reset_storage();
+  }
+  this->assign(v.begin(), v.end());
+
+  return *this;
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>& SmallVector<T, N, A>::operator=(SmallVector&& v) {
+  if (this == &v) {
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    if (get_allocator() != v.get_allocator()) {
+      this->release();
+      reset_storage();
+      this->alloc_ = buffer_allocator(v.get_allocator(), inline_data());
+    }
+  }
+  take(v);
+
+  return *this;
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::operator heap_vector() const& {
+  heap_vector result(
+      alloc_traits::select_on_container_copy_construction(get_allocator()));
+  result.append(this->begin(), this->end());
+  return result;
+}
+
+template <typename T, size_t N, typename A>
+SmallVector<T, N, A>::operator heap_vector() && {
+  heap_vector result(get_allocator());
+  if (is_inline()) {
+    result.append(std::make_move_iterator(this->data_),
+                  std::make_move_iterator(this->data_ + this->size_));
+    this->clear();
+  } else {
+    result.data_ = this->data_;
+    result.size_ = this->size_;
+    result.capacity_ = this->capacity_;
+    this->data_ = nullptr;
+    this->size_ = 0;
+    reset_storage();
+  }
+  return result;
+}
+
+// A vector whose buffer was released or handed over is back to an empty
+// heap state; point it at the inline buffer again.
+template <typename T, size_t N, typename A>
+void SmallVector<T, N, A>::reset_storage() noexcept {
+  if (!this->data_) {
+    this->data_ = inline_data();
+    this->capacity_ = N;
+  }
+}
+
+// Takes over the heap buffer of v, which must come from an equal allocator.
+template <typename T, size_t N, typename A>
+template <typename Vec>
+void SmallVector<T, N, A>::adopt(Vec& v) noexcept {
+  this->release();
+  this->data_ = v.data_;
+  this->size_ = v.size_;
+  this->capacity_ = v.capacity_;
+  v.data_ = nullptr;
+  v.size_ = v.capacity_ = 0;
+}
+
+// Adopts the heap buffer of v when the allocators allow it, otherwise moves
+// the elements over one by one.
+template <typename T, size_t N, typename A>
+void SmallVector<T, N, A>::take(SmallVector& v) {
+  if (!v.is_inline() && get_allocator() == v.get_allocator()) {
+    adopt(v);
+  } else {
+    this->clear();
+    this->append(std::make_move_iterator(v.data_),
+                 std::make_move_iterator(v.data_ + v.size_));
+    v.clear();
+  }
+  v.reset_storage();
+}
+
+template <typename T, size_t N, typename A>
+void SmallVector<T, N, A>::take(heap_vector& v) {
+  if (v.data_ && get_allocator() == v.alloc_) {
+    adopt(v);
+    return;
+  }
+  this->clear();
+  this->append(std::make_move_iterator(v.data_),
+               std::make_move_iterator(v.data_ + v.size_));
+  v.clear();
+}
+
+template <typename T, size_t N, typename A>
+void SmallVector<T, N, A>::shrink_to_fit() {
+  if (is_inline()) {
+    return;
+  }
+  if (this->size_ <= N) {
+    this->relocate(inline_data(), N);
+  } else {
+    base::shrink_to_fit();
+  }
+}
+
+template <typename T, size_t N, typename A>
+void SmallVector<T, N, A>::swap(SmallVector& other) {
+  if (!is_inline() && !other.is_inline() &&
+      get_allocator() == other.get_allocator()) {
+    std::swap(this->data_, other.data_);
+    std::swap(this->size_, other.size_);
+    std::swap(this->capacity_, other.capacity_);
+    return;
+  }
+  SmallVector tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+template <typename T, size_t N, typename A>
+void SmallVector<T, N, A>::swap(heap_vector& other) {
+  SmallVector tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+template <typename T, size_t N, typename A, typename Pred>
+typename SmallVector<T, N, A>::size_type erase_if(SmallVector<T, N, A>& v,
+                                                 Pred pred) {
+  auto new_end = std::remove_if(v.begin(), v.end(), pred);
+  auto removed = static_cast<typename SmallVector<T, N, A>::size_type>(
+      std::distance(new_end, v.end()));
+  v.erase(new_end, v.end());
+  return removed;
+}
+
+namespace pmr {
+
+template <typename T, size_t N>
+using SmallVector =
+    s21::SmallVector<T, N, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
+}  // namespace s21
@@ -0,0 +1,605 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// What a StaticVector does when an insertion would exceed its capacity.
+enum class OverflowPolicy { kThrow, kAssert, kReturnFalse };
+
+// Element storage of StaticVector. Trivial types live in a plain array that
+// is left uninitialized, like the raw bytes used for other types, so
+// constructing a StaticVector costs nothing whatever N is. The array keeps
+// the container a trivially copyable literal type; since C++17 requires
+// constexpr objects to be fully initialized, building one in a constant
+// expression needs C++20.
+template <typename T, size_t N, bool = std::is_trivial_v<T>>
+class StaticVectorStorage {
+ protected:
+  constexpr T* slots() noexcept { return data_; }
+  constexpr const T* slots() const noexcept { return data_; }
+
+  template <typename... Args>
+  constexpr void construct(size_t pos, Args&&... args) {
+    if constexpr (std::is_constructible_v<T, Args...>) {
+      data_[pos] = T(std::forward<Args>(args)...);
+    } else {
+      data_[pos] = T{std::forward<Args>(args)...};
+    }
+  }
+  constexpr void default_construct(size_t) noexcept {}
+  constexpr void destroy(size_t, size_t) noexcept {}
+
+  T data_[N];
+  size_t size_{0};
+};
+
+template <typename T, size_t N>
+class StaticVectorStorage<T, N, false> {
+ public:
+  StaticVectorStorage() noexcept {}
+  StaticVectorStorage(const StaticVectorStorage& other);
+  StaticVectorStorage(StaticVectorStorage&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~StaticVectorStorage() { destroy(0, size_); }
+
+  StaticVectorStorage& operator=(const StaticVectorStorage& other);
+  StaticVectorStorage& operator=(StaticVectorStorage&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+
+ protected:
+  T* slots() noexcept { return reinterpret_cast<T*>(bytes_); }
+  const T* slots() const noexcept {
+    return reinterpret_cast<const T*>(bytes_);
+  }
+
+  template <typename... Args>
+  void construct(size_t pos, Args&&... args) {
+    ::new (static_cast<void*>(slots() + pos)) T(std::forward<Args>(args)...);
+  }
+  void default_construct(size_t pos) {
+    ::new (static_cast<void*>(slots() + pos)) T;
+  }
+  void destroy(size_t first, size_t last) noexcept {
+    for (; first < last; ++first) {
+      slots()[first].~T();
+    }
+  }
+
+  alignas(T) unsigned char bytes_[N * sizeof(T)];
+  size_t size_{0};
+};
+
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false>::StaticVectorStorage(
+    const StaticVectorStorage& other) {
+  try {
+    for (; size_ < other.size_; ++size_) {
+      construct(size_, other.slots()[size_]);
+    }
+  } catch (...) {
+    destroy(0, size_);
+    throw;
+  }
+}
+
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false>::StaticVectorStorage(
+    StaticVectorStorage&& other) noexcept(
+    std::is_nothrow_move_constructible_v<T>) {
+  if constexpr (std::is_nothrow_move_constructible_v<T>) {
+    for (; size_ < other.size_; ++size_) {
+      construct(size_, std::move(other.slots()[size_]));
+    }
+  } else {
+    try {
+      for (; size_ < other.size_; ++size_) {
+        construct(size_, std::move(other.slots()[size_]));
+      }
+    } catch (...) {
+      destroy(0, size_);
+      throw;
+    }
+  }
+  other.destroy(0, other.size_);
+  other.size_ = 0;
+}
+
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false>& StaticVectorStorage<T, N, false>::operator=(
+    const StaticVectorStorage& other) {
+  if (this == &other) {
+    return *this;
+  }
+  size_t common = std::min(size_, other.size_);
+  std::copy(other.slots(), other.slots() + common, slots());
+  destroy(other.size_, size_);
+  for (size_ = common; size_ < other.size_; ++size_) {
+    construct(size_, other.slots()[size_]);
+  }
+
+  return *this;
+}
+
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false>& StaticVectorStorage<T, N, false>::operator=(
+    StaticVectorStorage&& other) noexcept(
+    std::is_nothrow_move_constructible_v<T>) {
+  if (this == &other) {
+    return *this;
+  }
+  destroy(0, size_);
+  for (size_ = 0; size_ < other.size_; ++size_) {
+    construct(size_, std::move(other.slots()[size_]));
+  }
+  other.destroy(0, other.size_);
+  other.size_ = 0;
+
+  return *this;
+}
+
+// Vector with a fixed capacity of N elements stored inside the object. It
+// never allocates. Insertions past N follow Policy: kThrow throws
+// std::length_error, kAssert fails an assertion (and drops the insertion
+// under NDEBUG), kReturnFalse drops it silently. Modifiers that return void
+// in Vector return whether the elements were added, the ones returning an
+// iterator return end() when they dropped the insertion. Bulk insertions
+// with a known length are all or nothing.
+template <typename T, size_t N,
+          OverflowPolicy Policy = OverflowPolicy::kThrow>
+class StaticVector : private StaticVectorStorage<T, N> {
+  template <typename It>
+  using iterator_category_t =
+      typename std::iterator_traits<It>::iterator_category;
+  template <typename It>
+  using if_input_iterator = std::enable_if_t<
+      std::is_convertible_v<iterator_category_t<It>, std::input_iterator_tag>>;
+  template <typename It>
+  static constexpr bool is_forward_iterator_v =
+      std::is_convertible_v<iterator_category_t<It>, std::forward_iterator_tag>;
+
+  static_assert(N > 0, "StaticVector needs a non-zero capacity");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using size_type = size_t;
+  using iterator = VectorIterator<T>;
+  using const_iterator = ConstVectorIterator<T>;
+
+  static constexpr OverflowPolicy overflow_policy = Policy;
+
+  constexpr StaticVector() noexcept = default;
+  explicit constexpr StaticVector(size_type count, const_reference value = {});
+  constexpr StaticVector(size_type count, default_init_t);
+  constexpr StaticVector(std::initializer_list<T> const& items);
+
+  constexpr reference operator[](size_type pos);
+  constexpr const_reference operator[](size_type pos) const;
+
+  constexpr const_reference front() const;
+  constexpr const_reference back() const;
+  constexpr pointer data() noexcept { return this->slots(); }
+  constexpr const_pointer data() const noexcept { return this->slots(); }
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  constexpr bool empty() const noexcept { return this->size_ == 0; }
+  constexpr size_type size() const noexcept { return this->size_; }
+  constexpr size_type max_size() const noexcept { return N; }
+  constexpr size_type capacity() const noexcept { return N; }
+  constexpr bool reserve(size_type new_cap);
+  constexpr void shrink_to_fit() noexcept {}
+  constexpr bool resize(size_type count);
+  constexpr bool resize(size_type count, const_reference value);
+  constexpr bool resize_for_overwrite(size_type count);
+
+  constexpr reference at(const size_type pos);
+  constexpr const_reference at(const size_type pos) const;
+  constexpr void set_element(size_type pos, const_reference value);
+  constexpr bool push_back(const_reference value);
+  constexpr bool push_back(T&& value);
+  template <typename... Args>
+  constexpr bool emplace_back(Args&&... args);
+  constexpr void clear() noexcept;
+
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, T&& value);
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args);
+  template <typename... Args>
+  iterator insert_many(iterator pos, Args&&... args);
+  template <typename... Args>
+  constexpr bool insert_many_back(Args&&... args);
+  template <typename InputIt, typename = if_input_iterator<InputIt>>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  template <typename InputIt, typename = if_input_iterator<InputIt>>
+  bool append(InputIt first, InputIt last);
+  bool append(const StaticVector& other);
+  template <typename InputIt, typename = if_input_iterator<InputIt>>
+  bool assign(InputIt first, InputIt last);
+
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  constexpr void pop_back();
+  void swap(StaticVector& other);
+
+ private:
+  constexpr bool fits(size_type count) const;
+  constexpr bool overflow() const;
+  template <typename ForwardIt>
+  void append_range(ForwardIt first, size_type count);
+};
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr bool StaticVector<T, N, P>::fits(size_type count) const {
+  return count <= N - this->size_ || overflow();
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr bool StaticVector<T, N, P>::overflow() const {
+  if constexpr (P == OverflowPolicy::kThrow) {
+    throw std::length_error("Error: StaticVector capacity exceeded");
+  } else if constexpr (P == OverflowPolicy::kAssert) {
+    assert(!"StaticVector capacity exceeded");
+  }
+  return false;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+template <typename ForwardIt>
+void StaticVector<T, N, P>::append_range(ForwardIt first, size_type count) {
+  for (; count; --count, ++first) {
+    this->construct(this->size_, *first);
+    ++this->size_;
+  }
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr StaticVector<T, N, P>::StaticVector(size_type count,
+                                              const_reference value) {
+  resize(count, value);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr StaticVector<T, N, P>::StaticVector(size_type count,
+                                              default_init_t) {
+  resize_for_overwrite(count);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr StaticVector<T, N, P>::StaticVector(
+    std::initializer_list<T> const& items) {
+  if (fits(items.size())) {
+    for (const_reference item : items) {
+      this->construct(this->size_, item);
+      ++this->size_;
+    }
+  }
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr typename StaticVector<T, N, P>::reference
+StaticVector<T, N, P>::operator[](size_type pos) {
+  return at(pos);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr typename StaticVector<T, N, P>::const_reference
+StaticVector<T, N, P>::operator[](size_type pos) const {
+  return at(pos);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr typename StaticVector<T, N, P>::reference StaticVector<T, N, P>::at(
+    const size_type pos) {
+  if (pos >= this->size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the vector");
+  }
+  return this->slots()[pos];
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr typename StaticVector<T, N, P>::const_reference
+StaticVector<T, N, P>::at(const size_type pos) const {
+  if (pos >= this->size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the vector");
+  }
+  return this->slots()[pos];
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr typename StaticVector<T, N, P>::const_reference
+StaticVector<T, N, P>::front() const {
+  return at(0);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr typename StaticVector<T, N, P>::const_reference
+StaticVector<T, N, P>::back() const {
+  return at(this->size_ - 1);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::iterator StaticVector<T, N, P>::begin() {
+  return iterator(this->slots(), this->size_);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::iterator StaticVector<T, N, P>::end() {
+  iterator b = begin();
+  return b + this->size_;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::const_iterator StaticVector<T, N, P>::begin()
+    const {
+  return const_iterator(this->slots(), this->size_);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::const_iterator StaticVector<T, N, P>::end()
+    const {
+  const_iterator b = begin();
+  return b + this->size_;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::const_iterator StaticVector<T, N, P>::cbegin()
+    const {
+  return begin();
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::const_iterator StaticVector<T, N, P>::cend()
+    const {
+  return end();
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr bool StaticVector<T, N, P>::reserve(size_type new_cap) {
+  return new_cap <= N || fits(new_cap - this->size_);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr bool StaticVector<T, N, P>::resize(size_type count) {
+  if (count > this->size_ && !fits(count - this->size_)) {
+    return false;
+  }
+  this->destroy(count, this->size_);
+  for (; this->size_ < count; ++this->size_) {
+    this->construct(this->size_);
+  }
+  this->size_ = count;
+  return true;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr bool StaticVector<T, N, P>::resize(size_type count,
+                                             const_reference value) {
+  if (count > this->size_ && !fits(count - this->size_)) {
+    return false;
+  }
+  this->destroy(count, this->size_);
+  for (; this->size_ < count; ++this->size_) {
+    this->construct(this->size_, value);
+  }
+  this->size_ = count;
+  return true;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr bool StaticVector<T, N, P>::resize_for_overwrite(size_type count) {
+  if (count > this->size_ && !fits(count - this->size_)) {
+    return false;
+  }
+  this->destroy(count, this->size_);
+  for (; this->size_ < count; ++this->size_) {
+    this->default_construct(this->size_);
+  }
+  this->size_ = count;
+  return true;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr void StaticVector<T, N, P>::set_element(size_type pos,
+                                                  const_reference value) {
+  at(pos) = value;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr bool StaticVector<T, N, P>::push_back(const_reference value) {
+  return emplace_back(value);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr bool StaticVector<T, N, P>::push_back(T&& value) {
+  return emplace_back(std::move(value));
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+template <typename... Args>
+constexpr bool StaticVector<T, N, P>::emplace_back(Args&&... args) {
+  if (!fits(1)) {
+    return false;
+  }
+  this->construct(this->size_, std::forward<Args>(args)...);
+  ++this->size_;
+  return true;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr void StaticVector<T, N, P>::clear() noexcept {
+  this->destroy(0, this->size_);
+  this->size_ = 0;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::iterator StaticVector<T, N, P>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::iterator StaticVector<T, N, P>::insert(
+    iterator pos, T&& value) {
+  return emplace(pos, std::move(value));
+}
+
+// Insertions in the middle build the new elements at the back and rotate
+// them into place, which also keeps arguments aliasing an element valid.
+template <typename T, size_t N, OverflowPolicy P>
+template <typename... Args>
+typename StaticVector<T, N, P>::iterator StaticVector<T, N, P>::emplace(
+    iterator pos, Args&&... args) {
+  size_type index = std::distance(begin(), pos);
+  if (!emplace_back(std::forward<Args>(args)...)) {
+    return end();
+  }
+  std::rotate(this->slots() + index, this->slots() + this->size_ - 1,
+              this->slots() + this->size_);
+
+  return begin() + index;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+template <typename... Args>
+typename StaticVector<T, N, P>::iterator StaticVector<T, N, P>::insert_many(
+    iterator pos, Args&&... args) {
+  size_type index = std::distance(begin(), pos);
+  if (!insert_many_back(std::forward<Args>(args)...)) {
+    return end();
+  }
+  pointer slots = this->slots();
+  std::rotate(slots + index, slots + this->size_ - sizeof...(args),
+              slots + this->size_);
+
+  return begin() + index;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+template <typename... Args>
+constexpr bool StaticVector<T, N, P>::insert_many_back(Args&&... args) {
+  if (!fits(sizeof...(args))) {
+    return false;
+  }
+  ((this->construct(this->size_, std::forward<Args>(args)), ++this->size_),
+   ...);
+  return true;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+template <typename InputIt, typename>
+typename StaticVector<T, N, P>::iterator StaticVector<T, N, P>::insert(
+    iterator pos, InputIt first, InputIt last) {
+  size_type index = std::distance(begin(), pos);
+  size_type old_size = this->size_;
+  if (!append(first, last)) {
+    return end();
+  }
+  std::rotate(this->slots() + index, this->slots() + old_size,
+              this->slots() + this->size_);
+
+  return begin() + index;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+template <typename InputIt, typename>
+bool StaticVector<T, N, P>::append(InputIt first, InputIt last) {
+  if constexpr (is_forward_iterator_v<InputIt>) {
+    size_type count = std::distance(first, last);
+    if (!fits(count)) {
+      return false;
+    }
+    append_range(first, count);
+  } else {
+    for (; first != last; ++first) {
+      if (!emplace_back(*first)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+bool StaticVector<T, N, P>::append(const StaticVector& other) {
+  if (!fits(other.size_)) {
+    return false;
+  }
+  append_range(other.slots(), other.size_);
+  return true;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+template <typename InputIt, typename>
+bool StaticVector<T, N, P>::assign(InputIt first, InputIt last) {
+  if constexpr (is_forward_iterator_v<InputIt>) {
+    if (static_cast<size_type>(std::distance(first, last)) > N) {
+      return overflow();
+    }
+  }
+  clear();
+  return append(first, last);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::iterator StaticVector<T, N, P>::erase(
+    iterator pos) {
+  iterator next = pos;
+  return erase(pos, ++next);
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+typename StaticVector<T, N, P>::iterator StaticVector<T, N, P>::erase(
+    iterator first, iterator last) {
+  size_type index = std::distance(begin(), first);
+  size_type count = std::distance(first, last);
+  if (count) {
+    pointer slots = this->slots();
+    std::move(slots + index + count, slots + this->size_, slots + index);
+    this->destroy(this->size_ - count, this->size_);
+    this->size_ -= count;
+  }
+  return begin() + index;
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+constexpr void StaticVector<T, N, P>::pop_back() {
+  if (this->size_ > 0) {
+    --this->size_;
+    this->destroy(this->size_, this->size_ + 1);
+  }
+}
+
+template <typename T, size_t N, OverflowPolicy P>
+void StaticVector<T, N, P>::swap(StaticVector& other) {
+  StaticVector* shorter = this->size_ < other.size_ ? this : &other;
+  StaticVector* longer = shorter == this ? &other : this;
+  size_type common = shorter->size_;
+  std::swap_ranges(this->slots(), this->slots() + common, other.slots());
+  for (size_type i = common; i < longer->size_; ++i) {
+    shorter->construct(i, std::move(longer->slots()[i]));
+  }
+  longer->destroy(common, longer->size_);
+  std::swap(this->size_, other.size_);
+}
+
+}  // namespace s21
@@ -1,35 +1,77 @@
 #pragma once
 
+#include <algorithm>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
 
 #include "s21_vector_iterator.h"
 
 namespace s21 {
 
-template <typename T>
+// Tag for constructors and resizes that default-initialize new elements:
+// trivially constructible ones are left with indeterminate values instead of
+// being zeroed, for buffers that are about to be overwritten anyway.
+struct default_init_t {
+  explicit default_init_t() = default;
+};
+inline constexpr default_init_t default_init{};
+
+template <typename T, typename Allocator = std::allocator<T>>
 class Vector {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  template <typename It>
+  using iterator_category_t =
+      typename std::iterator_traits<It>::iterator_category;
+  template <typename It>
+  using if_input_iterator = std::enable_if_t<
+      std::is_convertible_v<iterator_category_t<It>, std::input_iterator_tag>>;
+  template <typename It>
+  static constexpr bool is_forward_iterator_v =
+      std::is_convertible_v<iterator_category_t<It>, std::forward_iterator_tag>;
+
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T&;
   using const_reference = const T&;
+  using pointer = typename alloc_traits::pointer;
+  using const_pointer = typename alloc_traits::const_pointer;
   using size_type = size_t;
   using iterator = VectorIterator<T>;
   using const_iterator = ConstVectorIterator<T>;
 
-  Vector() = default;
-  explicit Vector(size_type capacity, const_reference value = {});
-  Vector(std::initializer_list<T> const& items);
-  Vector(const Vector<T>& v);
-  Vector(Vector<T>&& v) noexcept;
-  ~Vector() = default;
-
-  Vector& operator=(Vector&& v) noexcept;
+  Vector() : Vector(Allocator()) {}
+  explicit Vector(const Allocator& alloc) noexcept;
+  explicit Vector(size_type capacity, const_reference value = {},
+                  const Allocator& alloc = Allocator());
+  Vector(size_type count, default_init_t,
+         const Allocator& alloc = Allocator());
+  Vector(std::initializer_list<T> const& items,
+         const Allocator& alloc = Allocator());
+  Vector(const Vector& v);
+  Vector(const Vector& v, const Allocator& alloc);
+  Vector(Vector&& v) noexcept;
+  Vector(Vector&& v, const Allocator& alloc);
+  ~Vector();
+
+  Vector& operator=(const Vector& v);
+  Vector& operator=(Vector&& v) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value);
   reference operator[](size_type pos);
   const_reference operator[](size_type pos) const;
 
+  allocator_type get_allocator() const noexcept;
+
   const_reference front() const;
   const_reference back() const;
+  pointer data() noexcept;
+  const_pointer data() const noexcept;
 
   iterator begin();
   iterator end();
@@ -44,145 +86,515 @@ class Vector {
   void reserve(size_type new_cap);
   size_type capacity() const noexcept;
   void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+  void resize_for_overwrite(size_type count);
 
   reference at(const size_type pos);
   const_reference at(const size_type pos) const;
   void set_element(size_type pos, const_reference value);
   void push_back(const_reference value);
+  void push_back(T&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
   void clear();
 
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, T&& value);
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args);
   template <typename... Args>
   iterator insert_many(iterator pos, Args&&... args);
   template <typename... Args>
   void insert_many_back(Args&&... args);
-
-  void erase(iterator pos);
+  template <typename InputIt, typename = if_input_iterator<InputIt>>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  template <typename InputIt, typename = if_input_iterator<InputIt>>
+  void append(InputIt first, InputIt last);
+  void append(const Vector& other);
+  template <typename InputIt, typename = if_input_iterator<InputIt>>
+  void assign(InputIt first, InputIt last);
+
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  iterator unstable_erase(iterator pos);
   void pop_back();
-  void swap(Vector<T>& other);
+  void swap(Vector& other);
 
  protected:
-  void allocate_vector(size_type size);
+  pointer allocate_vector(size_type size);
+  void deallocate_vector(pointer data, size_type size) noexcept;
+  void destroy_range(pointer first, pointer last) noexcept;
+  void reallocate(size_type new_cap);
+  void relocate(pointer dest, size_type new_cap);
+  void relocate(pointer dest, size_type new_cap, size_type index,
+                size_type gap);
+  size_type grown_capacity(size_type count) const;
+  template <typename... Args>
+  void realloc_insert(size_type index, Args&&... args);
+  template <typename ForwardIt>
+  void realloc_insert_range(size_type index, ForwardIt first,
+                            size_type count);
+  template <typename ForwardIt>
+  void append_range(ForwardIt first, size_type count);
+  template <typename Construct>
+  void resize_with(size_type count, Construct construct);
+  void default_construct(pointer p);
+  template <typename ForwardIt>
+  void assign_range(ForwardIt first, size_type count);
+  void release() noexcept;
+  void steal(Vector& v) noexcept;
+  void move_elements(Vector& v);
 
  private:
-  std::shared_ptr<T[]> data_;
+  template <typename, size_t, typename>
+  friend class SmallVector;
+
+  pointer data_{nullptr};
   size_type size_{0};
   size_type capacity_{0};
+  Allocator alloc_;
 };
 
-template <typename T>
-void Vector<T>::allocate_vector(size_type size) {
+template <typename T, typename A>
+typename Vector<T, A>::pointer Vector<T, A>::allocate_vector(size_type size) {
+  if (!size) {
+    return nullptr;
+  }
+  if (size > max_size()) {
+    throw std::length_error("Error: Requested size exceeds max_size");
+  }
   try {
-    data_.reset(new T[size]);
+    return alloc_traits::allocate(alloc_, size);
   } catch (std::bad_alloc& e) {
     throw std::runtime_error("Error: Failed to allocate memory");
   }
 }
 
-template <typename T>
-Vector<T>::Vector(size_type capacity, const_reference value)
-    : size_(capacity), capacity_(capacity) {
-  allocate_vector(capacity_);
-  std::uninitialized_fill_n(data_.get(), capacity_, value);
+template <typename T, typename A>
+void Vector<T, A>::deallocate_vector(pointer data, size_type size) noexcept {
+  if (data) {
+    alloc_traits::deallocate(alloc_, data, size);
+  }
 }
 
-template <typename T>
-Vector<T>::Vector(std::initializer_list<T> const& items)
-    : size_(items.size()), capacity_(items.size()) {
-  allocate_vector(size_);
-  std::copy(items.begin(), items.end(), data_.get());
+template <typename T, typename A>
+void Vector<T, A>::destroy_range(pointer first, pointer last) noexcept {
+  for (; first != last; ++first) {
+    alloc_traits::destroy(alloc_, first);
+  }
 }
 
-template <typename T>
-Vector<T>::Vector(const Vector<T>& v) : size_(v.size()), capacity_(v.size()) {
-  allocate_vector(size_);
-  std::copy(v.begin(), v.end(), data_.get());
+// Moves the elements into dest, a buffer of new_cap slots, and adopts it. The
+// old buffer is only released once every element has been transferred, so a
+// throwing copy leaves the vector untouched and dest empty.
+template <typename T, typename A>
+void Vector<T, A>::relocate(pointer dest, size_type new_cap) {
+  relocate(dest, new_cap, size_, 0);
 }
 
-template <typename T>
-Vector<T>::Vector(Vector<T>&& v) noexcept
-    : data_(std::move(v.data_)), size_(v.size()), capacity_(v.size()) {
-  v.size_ = 0;
-  v.capacity_ = 0;
+// Same, but leaves gap unconstructed slots at index in dest for the caller to
+// fill, before or after the call. size_ is not changed.
+template <typename T, typename A>
+void Vector<T, A>::relocate(pointer dest, size_type new_cap, size_type index,
+                            size_type gap) {
+  size_type moved = 0;
+  try {
+    for (; moved < index; ++moved) {
+      alloc_traits::construct(alloc_, dest + moved,
+                              std::move_if_noexcept(data_[moved]));
+    }
+    for (; moved < size_; ++moved) {
+      alloc_traits::construct(alloc_, dest + moved + gap,
+                              std::move_if_noexcept(data_[moved]));
+    }
+  } catch (...) {
+    destroy_range(dest, dest + std::min(moved, index));
+    if (moved > index) {
+      destroy_range(dest + index + gap, dest + moved + gap);
+    }
+    throw;
+  }
+  destroy_range(data_, data_ + size_);
+  deallocate_vector(data_, capacity_);
+  data_ = dest;
+  capacity_ = new_cap;
 }
 
-template <typename T>
-Vector<T>& Vector<T>::operator=(Vector&& v) noexcept {
-  size_ = v.size();
-  capacity_ = v.capacity();
-  allocate_vector(size_);
-  std::copy(v.begin(), v.end(), data_.get());
+template <typename T, typename A>
+void Vector<T, A>::reallocate(size_type new_cap) {
+  pointer tmp = allocate_vector(new_cap);
+  try {
+    relocate(tmp, new_cap);
+  } catch (...) {
+    deallocate_vector(tmp, new_cap);
+    throw;
+  }
+}
+
+// Capacity to grow to when count more elements do not fit: doubling keeps
+// push_back amortized O(1), a large bulk insert gets exactly what it needs.
+template <typename T, typename A>
+typename Vector<T, A>::size_type Vector<T, A>::grown_capacity(
+    size_type count) const {
+  if (count > max_size() - size_) {
+    throw std::length_error("Error: Requested size exceeds max_size");
+  }
+  return std::max(std::min(capacity_ * 2, max_size()), size_ + count);
+}
+
+// Growth path of emplace. The new element is built first, straight into the
+// new buffer, because args may refer to an element of the old one.
+template <typename T, typename A>
+template <typename... Args>
+void Vector<T, A>::realloc_insert(size_type index, Args&&... args) {
+  size_type new_cap = grown_capacity(1);
+  pointer tmp = allocate_vector(new_cap);
+  try {
+    alloc_traits::construct(alloc_, tmp + index, std::forward<Args>(args)...);
+  } catch (...) {
+    deallocate_vector(tmp, new_cap);
+    throw;
+  }
+  try {
+    relocate(tmp, new_cap, index, 1);
+  } catch (...) {
+    alloc_traits::destroy(alloc_, tmp + index);
+    deallocate_vector(tmp, new_cap);
+    throw;
+  }
+  ++size_;
+}
+
+// Growth path of the range insert, one allocation for the whole range. As in
+// realloc_insert the range is copied before the old buffer is touched, so it
+// may come from this vector.
+template <typename T, typename A>
+template <typename ForwardIt>
+void Vector<T, A>::realloc_insert_range(size_type index, ForwardIt first,
+                                        size_type count) {
+  size_type new_cap = grown_capacity(count);
+  pointer tmp = allocate_vector(new_cap);
+  size_type built = 0;
+  try {
+    for (; built < count; ++built, ++first) {
+      alloc_traits::construct(alloc_, tmp + index + built, *first);
+    }
+    relocate(tmp, new_cap, index, count);
+  } catch (...) {
+    destroy_range(tmp + index, tmp + index + built);
+    deallocate_vector(tmp, new_cap);
+    throw;
+  }
+  size_ += count;
+}
+
+template <typename T, typename A>
+template <typename ForwardIt>
+void Vector<T, A>::append_range(ForwardIt first, size_type count) {
+  if (count > capacity_ - size_) {
+    realloc_insert_range(size_, first, count);
+    return;
+  }
+  for (; count; --count, ++first) {
+    alloc_traits::construct(alloc_, data_ + size_, *first);
+    ++size_;
+  }
+}
+
+// Shrinks, or grows by calling construct on each new slot. On growth the new
+// elements are built first, so construct may read from the vector.
+template <typename T, typename A>
+template <typename Construct>
+void Vector<T, A>::resize_with(size_type count, Construct construct) {
+  if (count <= size_) {
+    destroy_range(data_ + count, data_ + size_);
+    size_ = count;
+    return;
+  }
+  if (count <= capacity_) {
+    for (; size_ < count; ++size_) {
+      construct(data_ + size_);
+    }
+    return;
+  }
+
+  size_type new_cap = grown_capacity(count - size_);
+  pointer tmp = allocate_vector(new_cap);
+  size_type built = size_;
+  try {
+    for (; built < count; ++built) {
+      construct(tmp + built);
+    }
+    relocate(tmp, new_cap);
+  } catch (...) {
+    destroy_range(tmp + size_, tmp + built);
+    deallocate_vector(tmp, new_cap);
+    throw;
+  }
+  size_ = count;
+}
+
+template <typename T, typename A>
+void Vector<T, A>::default_construct(pointer p) {
+  if constexpr (std::is_trivially_default_constructible_v<T>) {
+    ::new (static_cast<void*>(std::addressof(*p))) T;
+  } else {
+    alloc_traits::construct(alloc_, p);
+  }
+}
+
+// Reuses the current buffer when the range fits: live elements are assigned
+// over, the rest is constructed or destroyed.
+template <typename T, typename A>
+template <typename ForwardIt>
+void Vector<T, A>::assign_range(ForwardIt first, size_type count) {
+  if (count > capacity_) {
+    Vector tmp(alloc_);
+    tmp.data_ = tmp.allocate_vector(count);
+    tmp.capacity_ = count;
+    for (; tmp.size_ < count; ++tmp.size_, ++first) {
+      alloc_traits::construct(tmp.alloc_, tmp.data_ + tmp.size_, *first);
+    }
+    release();
+    steal(tmp);
+    return;
+  }
+
+  size_type common = std::min(count, size_);
+  for (size_type i = 0; i < common; ++i, ++first) {
+    data_[i] = *first;
+  }
+  if (count < size_) {
+    destroy_range(data_ + count, data_ + size_);
+  }
+  for (size_ = common; size_ < count; ++size_, ++first) {
+    alloc_traits::construct(alloc_, data_ + size_, *first);
+  }
+}
+
+template <typename T, typename A>
+void Vector<T, A>::release() noexcept {
+  destroy_range(data_, data_ + size_);
+  deallocate_vector(data_, capacity_);
+  data_ = nullptr;
+  size_ = capacity_ = 0;
+}
+
+template <typename T, typename A>
+void Vector<T, A>::steal(Vector& v) noexcept {
+  data_ = v.data_;
+  size_ = v.size_;
+  capacity_ = v.capacity_;
+  v.data_ = nullptr;
+  v.size_ = v.capacity_ = 0;
+}
+
+// Fallback of the moves for storage that cannot be adopted because it comes
+// from an unequal allocator.
+template <typename T, typename A>
+void Vector<T, A>::move_elements(Vector& v) {
+  clear();
+  if (v.size_ > capacity_) {
+    reallocate(v.size_);
+  }
+  for (; size_ < v.size_; ++size_) {
+    alloc_traits::construct(alloc_, data_ + size_, std::move(v.data_[size_]));
+  }
+  v.clear();
+}
+
+template <typename T, typename A>
+Vector<T, A>::Vector(const A& alloc) noexcept : alloc_(alloc) {}
+
+template <typename T, typename A>
+Vector<T, A>::Vector(size_type capacity, const_reference value, const A& alloc)
+    : alloc_(alloc) {
+  data_ = allocate_vector(capacity);
+  capacity_ = capacity;
+  try {
+    for (; size_ < capacity; ++size_) {
+      alloc_traits::construct(alloc_, data_ + size_, value);
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+Vector<T, A>::Vector(size_type count, default_init_t, const A& alloc)
+    : alloc_(alloc) {
+  data_ = allocate_vector(count);
+  capacity_ = count;
+  try {
+    for (; size_ < count; ++size_) {
+      default_construct(data_ + size_);
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+Vector<T, A>::Vector(std::initializer_list<T> const& items, const A& alloc)
+    : alloc_(alloc) {
+  try {
+    assign_range(items.begin(), items.size());
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+Vector<T, A>::Vector(const Vector& v)
+    : Vector(v, alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+}
+
+template <typename T, typename A>
+Vector<T, A>::Vector(const Vector& v, const A& alloc) : alloc_(alloc) {
+  try {
+    assign_range(v.data_, v.size_);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+Vector<T, A>::Vector(Vector&& v) noexcept : alloc_(std::move(v.alloc_)) {
+  steal(v);
+}
+
+template <typename T, typename A>
+Vector<T, A>::Vector(Vector&& v, const A& alloc) : alloc_(alloc) {
+  if (alloc_ == v.alloc_) {
+    steal(v);
+    return;
+  }
+  try {
+    move_elements(v);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename A>
+Vector<T, A>::~Vector() {
+  release();
+}
+
+template <typename T, typename A>
+Vector<T, A>& Vector<T, A>::operator=(const Vector& v) {
+  if (this == &v) {
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+    if (alloc_ != v.alloc_) {
+      release();
+    }
+    alloc_ = v.alloc_;
+  }
+  assign_range(v.data_, v.size_);
 
   return *this;
 }
 
-template <typename T>
-bool Vector<T>::empty() const noexcept {
+template <typename T, typename A>
+Vector<T, A>& Vector<T, A>::operator=(Vector&& v) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
+  if (this == &v) {
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    release();
+    alloc_ = std::move(v.alloc_);
+    steal(v);
+  } else if (alloc_ == v.alloc_) {
+    release();
+    steal(v);
+  } else {
+    move_elements(v);
+  }
+
+  return *this;
+}
+
+template <typename T, typename A>
+typename Vector<T, A>::allocator_type Vector<T, A>::get_allocator()
+    const noexcept {
+  return alloc_;
+}
+
+template <typename T, typename A>
+bool Vector<T, A>::empty() const noexcept {
   return size_ == 0;
 }
 
-template <typename T>
-typename Vector<T>::size_type Vector<T>::size() const noexcept {
+template <typename T, typename A>
+typename Vector<T, A>::size_type Vector<T, A>::size() const noexcept {
   return size_;
 }
 
-template <typename T>
-typename Vector<T>::size_type Vector<T>::max_size() const noexcept {
-  return std::numeric_limits<size_type>::max();
+template <typename T, typename A>
+typename Vector<T, A>::size_type Vector<T, A>::max_size() const noexcept {
+  return std::min<size_type>(alloc_traits::max_size(alloc_),
+                             std::numeric_limits<std::ptrdiff_t>::max());
 }
 
-template <typename T>
-typename Vector<T>::size_type Vector<T>::capacity() const noexcept {
+template <typename T, typename A>
+typename Vector<T, A>::size_type Vector<T, A>::capacity() const noexcept {
   return capacity_;
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::begin() {
+template <typename T, typename A>
+typename Vector<T, A>::iterator Vector<T, A>::begin() {
   return iterator(data_, size_);
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::end() {
+template <typename T, typename A>
+typename Vector<T, A>::iterator Vector<T, A>::end() {
   iterator b = begin();
   return b + size_;
 }
 
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::begin() const {
+template <typename T, typename A>
+typename Vector<T, A>::const_iterator Vector<T, A>::begin() const {
   return const_iterator(data_, size_);
 }
 
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::end() const {
+template <typename T, typename A>
+typename Vector<T, A>::const_iterator Vector<T, A>::end() const {
   const_iterator b = begin();
   return b + size_;
 }
 
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::cbegin() const {
+template <typename T, typename A>
+typename Vector<T, A>::const_iterator Vector<T, A>::cbegin() const {
   return const_iterator(data_, size_);
 }
 
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::cend() const {
+template <typename T, typename A>
+typename Vector<T, A>::const_iterator Vector<T, A>::cend() const {
   const_iterator b = cbegin();
   return b + size_;
 }
 
-template <typename T>
-void Vector<T>::reserve(size_type new_cap) {
+template <typename T, typename A>
+void Vector<T, A>::reserve(size_type new_cap) {
   if (!new_cap) new_cap = 2;
 
   if (new_cap > capacity()) {
-    auto tmp{*this};
-    capacity_ = new_cap;
-    allocate_vector(capacity_);
-    std::copy(tmp.begin(), tmp.end(), data_.get());
+    reallocate(new_cap);
   }
 }
 
-template <typename T>
-typename Vector<T>::reference Vector<T>::at(const size_type pos) {
+template <typename T, typename A>
+typename Vector<T, A>::reference Vector<T, A>::at(const size_type pos) {
   if (pos >= size_) {
     throw std::out_of_range("Error: Attempt to access beyond the vector");
   }
@@ -191,8 +603,9 @@ typename Vector<T>::reference Vector<T>::at(const size_type pos) {
   return *it;
 }
 
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::at(const size_type pos) const {
+template <typename T, typename A>
+typename Vector<T, A>::const_reference Vector<T, A>::at(
+    const size_type pos) const {
   if (pos >= size_) {
     throw std::out_of_range("Error: Attempt to access beyond the vector");
   }
@@ -201,114 +614,303 @@ typename Vector<T>::const_reference Vector<T>::at(const size_type pos) const {
   return *it;
 }
 
-template <typename T>
-typename Vector<T>::reference Vector<T>::operator[](size_type pos) {
+template <typename T, typename A>
+typename Vector<T, A>::reference Vector<T, A>::operator[](size_type pos) {
   return at(pos);
 }
 
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::operator[](size_type pos) const {
+template <typename T, typename A>
+typename Vector<T, A>::const_reference Vector<T, A>::operator[](
+    size_type pos) const {
   return at(pos);
 }
 
-template <typename T>
-void Vector<T>::set_element(size_type pos, const_reference value) {
+template <typename T, typename A>
+void Vector<T, A>::set_element(size_type pos, const_reference value) {
   this->at(pos) = value;
 }
 
-template <typename T>
-void Vector<T>::push_back(const_reference value) {
-  insert_many_back(value);
+template <typename T, typename A>
+void Vector<T, A>::push_back(const_reference value) {
+  emplace_back(value);
 }
 
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::front() const {
+template <typename T, typename A>
+void Vector<T, A>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename Vector<T, A>::reference Vector<T, A>::emplace_back(Args&&... args) {
+  if (size_ == capacity_) {
+    realloc_insert(size_, std::forward<Args>(args)...);
+  } else {
+    alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  }
+
+  return data_[size_ - 1];
+}
+
+template <typename T, typename A>
+typename Vector<T, A>::const_reference Vector<T, A>::front() const {
   return at(0);
 }
 
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::back() const {
+template <typename T, typename A>
+typename Vector<T, A>::const_reference Vector<T, A>::back() const {
   return at(size_ - 1);
 }
 
-template <typename T>
-void Vector<T>::shrink_to_fit() {
+template <typename T, typename A>
+typename Vector<T, A>::pointer Vector<T, A>::data() noexcept {
+  return data_;
+}
+
+template <typename T, typename A>
+typename Vector<T, A>::const_pointer Vector<T, A>::data() const noexcept {
+  return data_;
+}
+
+template <typename T, typename A>
+void Vector<T, A>::shrink_to_fit() {
   if (size_ < capacity_) {
-    capacity_ = size_;
-    std::shared_ptr<T[]> tmp(new T[capacity_]);
-    std::copy(data_.get(), data_.get() + size_, tmp.get());
-    data_ = std::move(tmp);
+    if (size_) {
+      reallocate(size_);
+    } else {
+      release();
+    }
   }
 }
 
-template <typename T>
-void Vector<T>::clear() {
+template <typename T, typename A>
+void Vector<T, A>::resize(size_type count) {
+  resize_with(count, [this](pointer p) { alloc_traits::construct(alloc_, p); });
+}
+
+template <typename T, typename A>
+void Vector<T, A>::resize(size_type count, const_reference value) {
+  resize_with(count,
+              [this, &value](pointer p) {
+                alloc_traits::construct(alloc_, p, value);
+              });
+}
+
+template <typename T, typename A>
+void Vector<T, A>::resize_for_overwrite(size_type count) {
+  resize_with(count, [this](pointer p) { default_construct(p); });
+}
+
+template <typename T, typename A>
+void Vector<T, A>::clear() {
+  destroy_range(data_, data_ + size_);
   size_ = 0;
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::insert(iterator pos,
-                                               const_reference value) {
-  return insert_many(pos, value);
+template <typename T, typename A>
+typename Vector<T, A>::iterator Vector<T, A>::insert(iterator pos,
+                                                     const_reference value) {
+  return emplace(pos, value);
 }
 
-template <typename T>
-void Vector<T>::erase(iterator pos) {
-  size_t posIndex = std::distance(begin(), pos);
-  auto it = begin();
-  for (size_t i = posIndex; i < size() - 1; ++i) {
-    it[i] = it[i + 1];
+template <typename T, typename A>
+typename Vector<T, A>::iterator Vector<T, A>::insert(iterator pos,
+                                                     T&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename Vector<T, A>::iterator Vector<T, A>::emplace(iterator pos,
+                                                      Args&&... args) {
+  size_type index = std::distance(begin(), pos);
+
+  if (size_ == capacity_) {
+    realloc_insert(index, std::forward<Args>(args)...);
+  } else if (index == size_) {
+    alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  } else {
+    // The tail is shifted by one slot before the new value lands, so it is
+    // built up front in case args alias an element about to move.
+    value_type tmp(std::forward<Args>(args)...);
+    alloc_traits::construct(alloc_, data_ + size_,
+                            std::move(data_[size_ - 1]));
+    std::move_backward(data_ + index, data_ + size_ - 1, data_ + size_);
+    ++size_;
+    data_[index] = std::move(tmp);
   }
-  --size_;
+
+  return begin() + index;
 }
 
-template <typename T>
-void Vector<T>::pop_back() {
+template <typename T, typename A>
+typename Vector<T, A>::iterator Vector<T, A>::erase(iterator pos) {
+  iterator next = pos;
+  return erase(pos, ++next);
+}
+
+// Slides the tail over the gap in one pass and destroys the moved-from slots
+// left at the end, so removing k elements costs O(size) rather than O(size*k).
+template <typename T, typename A>
+typename Vector<T, A>::iterator Vector<T, A>::erase(iterator first,
+                                                    iterator last) {
+  size_type index = std::distance(begin(), first);
+  size_type count = std::distance(first, last);
+  if (count) {
+    pointer new_end =
+        std::move(data_ + index + count, data_ + size_, data_ + index);
+    destroy_range(new_end, data_ + size_);
+    size_ -= count;
+  }
+  return begin() + index;
+}
+
+// O(1) erase that does not keep the order: the last element is moved into
+// the hole.
+template <typename T, typename A>
+typename Vector<T, A>::iterator Vector<T, A>::unstable_erase(iterator pos) {
+  size_type index = std::distance(begin(), pos);
+  if (index != size_ - 1) {
+    data_[index] = std::move(data_[size_ - 1]);
+  }
+  pop_back();
+  return begin() + index;
+}
+
+template <typename T, typename A>
+void Vector<T, A>::pop_back() {
   if (size_ > 0) {
-    --size_;
+    alloc_traits::destroy(alloc_, data_ + --size_);
   }
 }
 
-template <typename T>
-void Vector<T>::swap(Vector<T>& other) {
+template <typename T, typename A>
+void Vector<T, A>::swap(Vector& other) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
   std::swap(data_, other.data_);
   std::swap(size_, other.size_);
   std::swap(capacity_, other.capacity_);
 }
 
-template <typename T>
+template <typename T, typename A>
 template <typename... Args>
-typename Vector<T>::iterator Vector<T>::insert_many(iterator pos,
-                                                    Args&&... args) {
+typename Vector<T, A>::iterator Vector<T, A>::insert_many(iterator pos,
+                                                          Args&&... args) {
   size_t posIndex = std::distance(begin(), pos);
   size_t numArgs = sizeof...(args);
 
-  if (size() + numArgs > capacity()) {
-    reserve(size() +
-            numArgs);  // Adjust the capacity to accommodate the new elements
-    pos = begin() + posIndex;  // Update the iterator after resizing
+  // New elements are built at the back and rotated into place, so the raw
+  // capacity past size_ is never assigned to.
+  insert_many_back(std::forward<Args>(args)...);
+  std::rotate(data_ + posIndex, data_ + size_ - numArgs, data_ + size_);
+
+  return begin() + posIndex;
+}
+
+template <typename T, typename A>
+template <typename... Args>
+void Vector<T, A>::insert_many_back(Args&&... args) {
+  size_type count = sizeof...(args);
+  if (count <= capacity_ - size_) {
+    ((alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)),
+      ++size_),
+     ...);
+    return;
   }
 
-  auto it = begin() + posIndex;
-  for (size_t i = size() + numArgs - 1; i >= posIndex + numArgs; --i) {
-    it[i] = it[i - numArgs];
+  // Same scheme as realloc_insert_range: one allocation, new elements first.
+  size_type new_cap = grown_capacity(count);
+  pointer tmp = allocate_vector(new_cap);
+  size_type built = size_;
+  try {
+    ((alloc_traits::construct(alloc_, tmp + built, std::forward<Args>(args)),
+      ++built),
+     ...);
+    relocate(tmp, new_cap);
+  } catch (...) {
+    destroy_range(tmp + size_, tmp + built);
+    deallocate_vector(tmp, new_cap);
+    throw;
+  }
+  size_ = built;
+}
+
+template <typename T, typename A>
+template <typename InputIt, typename>
+typename Vector<T, A>::iterator Vector<T, A>::insert(iterator pos,
+                                                     InputIt first,
+                                                     InputIt last) {
+  size_type index = std::distance(begin(), pos);
+  size_type old_size = size_;
+
+  if constexpr (is_forward_iterator_v<InputIt>) {
+    size_type count = std::distance(first, last);
+    if (count > capacity_ - size_) {
+      realloc_insert_range(index, first, count);
+      return begin() + index;
+    }
+    append_range(first, count);
+  } else {
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
   }
+  std::rotate(data_ + index, data_ + old_size, data_ + size_);
 
-  // Use fold expression to expand and insert args
-  ((it[posIndex++] = std::forward<Args>(args)), ...);
+  return begin() + index;
+}
 
-  size_ += numArgs;
+template <typename T, typename A>
+template <typename InputIt, typename>
+void Vector<T, A>::append(InputIt first, InputIt last) {
+  if constexpr (is_forward_iterator_v<InputIt>) {
+    append_range(first, std::distance(first, last));
+  } else {
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+}
 
-  return pos;
+template <typename T, typename A>
+void Vector<T, A>::append(const Vector& other) {
+  append_range(other.data_, other.size_);
 }
 
-template <typename T>
-template <typename... Args>
-void Vector<T>::insert_many_back(Args&&... args) {
-  if (size() == capacity()) {
-    reserve(capacity() * 2);
+template <typename T, typename A>
+template <typename InputIt, typename>
+void Vector<T, A>::assign(InputIt first, InputIt last) {
+  if constexpr (is_forward_iterator_v<InputIt>) {
+    assign_range(first, std::distance(first, last));
+  } else {
+    clear();
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
   }
-  ((data_[size_++] = std::forward<Args>(args)), ...);
 }
 
+// Removes every element matching pred in a single compacting pass and
+// returns how many were removed.
+template <typename T, typename A, typename Pred>
+typename Vector<T, A>::size_type erase_if(Vector<T, A>& v, Pred pred) {
+  auto new_end = std::remove_if(v.begin(), v.end(), pred);
+  auto removed = static_cast<typename Vector<T, A>::size_type>(
+      std::distance(new_end, v.end()));
+  v.erase(new_end, v.end());
+  return removed;
+}
+
+namespace pmr {
+
+template <typename T>
+using Vector = s21::Vector<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
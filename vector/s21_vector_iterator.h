@@ -4,8 +4,8 @@
 
 namespace s21 {
 
-template <typename T>
-class S21Vector;
+template <typename T, typename Allocator>
+class Vector;
 
 template <typename T>
 class VectorIterator : public BaseArrayIterator<T> {
@@ -48,14 +48,14 @@ class VectorIterator : public BaseArrayIterator<T> {
   difference_type operator-(const VectorIterator<T>& other);
 
  private:
-  friend class S21Vector<T>;
+  template <typename, typename>
+  friend class Vector;
 };
 
 template <typename T>
 bool VectorIterator<T>::operator==(
     const VectorIterator<T>& other) const noexcept {
-  return this->get_shared().get() == other.get_shared().get() &&
-         this->index_ == other.index_;
+  return this->ptr_ == other.ptr_ && this->index_ == other.index_;
 }
 
 template <typename T>
@@ -146,7 +146,7 @@ bool VectorIterator<T>::operator<=(
 
 template <typename T>
 typename VectorIterator<T>::reference VectorIterator<T>::operator[](int pos) {
-  return *(this->get_shared().get() + pos);
+  return *(this->ptr_ + pos);
 }
 
 template <typename T>
@@ -188,14 +188,14 @@ class ConstVectorIterator : public BaseArrayIterator<const T> {
   difference_type operator-(const ConstVectorIterator<T>& other) const noexcept;
 
  private:
-  friend class S21Vector<T>;
+  template <typename, typename>
+  friend class Vector;
 };
 
 template <typename T>
 bool ConstVectorIterator<T>::operator==(
     const ConstVectorIterator<T>& other) const noexcept {
-  return this->get_shared().get() == other.get_shared().get() &&
-         this->index_ == other.index_;
+  return this->ptr_ == other.ptr_ && this->index_ == other.index_;
 }
 
 template <typename T>